@@ -0,0 +1,99 @@
+#include "CombTable.h"
+
+/**
+ * @brief Construct an empty Comb Table object
+ */
+CombTable::CombTable() {
+	columns = 0;
+}
+
+/**
+ * @brief compress a dense table
+ * @details the default of a row is its most common entry among those canDefault accepts, or 0.
+ * 		The errors of a row are dropped with its default, so they read as the default.
+ * 		The rows with most entries are placed first, each at the lowest displacement where all its entries
+ * 		fall on free slots; the vector is padded so that base[row] + column never runs past its end.
+ * @param dense: the table, row by row
+ * @param rows
+ * @param columns
+ * @param canDefault: if an entry may be taken for the default of its row
+ */
+void CombTable::build(const TableEntry* dense, int rows, int columns, bool (*canDefault)(TableEntry)) {
+	this->columns = columns;
+	base.assign(rows, 0);
+	defaults.assign(rows, 0);
+	check.clear();
+	value.clear();
+
+	// the default and the remaining entries of each row
+	vector<vector<int> > entries(rows);
+	for (int row = 0; row < rows; row++) {
+		const TableEntry* line = dense + (size_t)row * columns;
+		map<TableEntry, int> count;
+		for (int column = 0; column < columns; column++) {
+			if (line[column] != 0 && canDefault(line[column])) {
+				count[line[column]]++;
+			}
+		}
+		int most = 0;
+		for (map<TableEntry, int>::iterator iter = count.begin(); iter != count.end(); iter++) {
+			if (iter->second > most) {
+				most = iter->second;
+				defaults[row] = iter->first;
+			}
+		}
+		for (int column = 0; column < columns; column++) {
+			if (line[column] != 0 && line[column] != defaults[row]) {
+				entries[row].push_back(column);
+			}
+		}
+	}
+
+	// place the rows with most entries first
+	vector<int> order(rows);
+	for (int row = 0; row < rows; row++) {
+		order[row] = row;
+	}
+	stable_sort(order.begin(), order.end(), [&](int one, int other) {
+		return entries[one].size() > entries[other].size();
+	});
+	for (int k = 0; k < rows; k++) {
+		int row = order[k];
+		const vector<int>& columnsOfRow = entries[row];
+		int displacement = 0;
+		while (true) {
+			bool fit = true;
+			for (size_t i = 0; i < columnsOfRow.size() && fit; i++) {
+				size_t slot = displacement + columnsOfRow[i];
+				fit = slot >= check.size() || check[slot] == -1;
+			}
+			if (fit) {
+				break;
+			}
+			displacement++;
+		}
+		base[row] = displacement;
+		if (check.size() < (size_t)displacement + columns) {
+			check.resize((size_t)displacement + columns, -1);
+			value.resize((size_t)displacement + columns, 0);
+		}
+		for (size_t i = 0; i < columnsOfRow.size(); i++) {
+			size_t slot = displacement + columnsOfRow[i];
+			check[slot] = (int16_t)row;
+			value[slot] = dense[(size_t)row * columns + columnsOfRow[i]];
+		}
+	}
+	if (check.empty()) {
+		check.assign(columns, -1);
+		value.assign(columns, 0);
+	}
+}
+
+/**
+ * @brief get the memory used by the arrays
+ * @return size_t
+ */
+size_t CombTable::memoryUsage() const {
+	return base.size() * sizeof(int32_t) + check.size() * sizeof(int16_t)
+		+ value.size() * sizeof(TableEntry) + defaults.size() * sizeof(TableEntry);
+}
@@ -0,0 +1,40 @@
+#ifndef COMBTABLE_H
+#define COMBTABLE_H
+#include "utils.h"
+
+/**
+ * @brief an entry of the parse tables, see table.h
+ */
+typedef int16_t TableEntry;
+
+/**
+ * @brief a sparse table compressed by row displacement (comb vector), with a default entry per row
+ * @author chtholly
+ * @details the entries of a row which are not its default are put into one shared vector, the row starting at
+ * 		its own displacement, and the rows are fitted into each other like the teeth of combs.
+ * 		A slot remembers the row it belongs to, so a lookup is: slot = base[row] + column, the entry if the slot
+ * 		belongs to the row, otherwise the default of the row.
+ */
+class CombTable {
+private:
+	vector<int32_t> base;			// displacement of each row
+	vector<int16_t> check;			// the row owning each slot, -1 for a free slot
+	vector<TableEntry> value;		// the entry in each slot
+	vector<TableEntry> defaults;	// the default entry of each row
+	int columns;					// number of columns of the dense table
+public:
+	CombTable();
+	// compress a dense table of rows * columns, canDefault tells which entries may become the default of a row
+	void build(const TableEntry* dense, int rows, int columns, bool (*canDefault)(TableEntry));
+	// the entry of the table, or the default of the row
+	TableEntry lookup(int row, int column) const {
+		int slot = base[row] + column;
+		return (unsigned)column < (unsigned)columns && check[slot] == row ? value[slot] : defaults[row];
+	}
+	// bytes taken by the arrays
+	size_t memoryUsage() const;
+	// number of slots of the comb vector
+	size_t slotCount() const { return check.size(); }
+};
+
+#endif // !COMBTABLE_H
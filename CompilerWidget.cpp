@@ -13,6 +13,7 @@ CompilerWidget::CompilerWidget(QWidget *parent)
     // init compiler
     compiler = nullptr;
     sourceFile = "";
+    highlighting = false;
     // set all the browser have a vertical scroll bar
     ui.infoBrowser->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
     ui.messageBrowser->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
@@ -23,6 +24,7 @@ CompilerWidget::CompilerWidget(QWidget *parent)
     connect(ui.actionClean_file, SIGNAL(triggered()), this, SLOT(cleanText()));
     connect(ui.actionSave_file, SIGNAL(triggered()), this, SLOT(saveFile()));
     connect(ui.sourceEdit, SIGNAL(textChanged()), this, SLOT(textChanged()));
+    connect(ui.sourceEdit->document(), SIGNAL(contentsChange(int, int, int)), this, SLOT(sourceChanged(int, int, int)));
     connect(ui.actionClose_file, SIGNAL(triggered()), this, SLOT(closeFile()));
     connect(ui.actionSave_as, SIGNAL(triggered()), this, SLOT(saveFileAs()));
     connect(ui.actionRun_Compiler, SIGNAL(triggered()), this, SLOT(compile()));
@@ -161,6 +163,98 @@ void CompilerWidget::textChanged(){
     ui.tabWidget_2->setTabText(0, "Source Code*");
 }
 
+/**
+ * @brief the text of a line for the lexer, one char for each QChar so that the columns agree
+ */
+static string lineText(const QString& text){
+    QByteArray latin = text.toLatin1();
+    return string(latin.constData(), latin.size());
+}
+
+/**
+ * @brief the format of a token in the editor
+ * @return QTextCharFormat: an empty format if the token is not colored
+ */
+static QTextCharFormat tokenFormat(TokenType type){
+    QTextCharFormat format;
+    if(type >= IF && type <= WHILE){
+        format.setForeground(Qt::darkBlue);
+        format.setFontWeight(QFont::Bold);
+    }
+    else if(type == NUM){
+        format.setForeground(Qt::darkMagenta);
+    }
+    else if(type == LCOMMENT || type == PCOMMENT){
+        format.setForeground(Qt::darkGreen);
+    }
+    else if(type == ERROR){
+        format.setUnderlineColor(Qt::red);
+        format.setUnderlineStyle(QTextCharFormat::WaveUnderline);
+    }
+    return format;
+}
+
+/**
+ * @brief when some chars of the text edit changed
+ * @details map the change to lines and give them to the incremental lexer,
+ *      only the lines it lexed again are colored again
+ * @param position: the first changed char
+ * @param charsRemoved: number of chars removed
+ * @param charsAdded: number of chars added
+ */
+void CompilerWidget::sourceChanged(int position, int charsRemoved, int charsAdded){
+    // changing the formats is also reported as a change
+    if(highlighting){
+        return;
+    }
+    QTextDocument* document = ui.sourceEdit->document();
+    QTextBlock firstBlock = document->findBlock(position);
+    QTextBlock lastBlock = document->findBlock(position + charsAdded);
+    int first = firstBlock.isValid() ? firstBlock.blockNumber() : 0;
+    int last = lastBlock.isValid() ? lastBlock.blockNumber() : document->blockCount() - 1;
+    // the lines between first and last are new, the number of lines before and after gives the old ones
+    int inserted = last - first + 1;
+    int removed = editorLexer.lineCount() - (document->blockCount() - inserted);
+    if(removed < 0 || first + removed > editorLexer.lineCount()){
+        editorLexer.setText(lineText(document->toPlainText()));
+        highlightLines(0, editorLexer.lineCount());
+        return;
+    }
+    vector<string> lines;
+    for(QTextBlock block = firstBlock; block.isValid() && block.blockNumber() <= last; block = block.next()){
+        lines.push_back(lineText(block.text()));
+    }
+    int end = editorLexer.edit(first, removed, lines);
+    highlightLines(first, end);
+}
+
+/**
+ * @brief color the tokens of some lines in the text edit
+ * @param first: the first line
+ * @param end: one past the last line
+ */
+void CompilerWidget::highlightLines(int first, int end){
+    QTextDocument* document = ui.sourceEdit->document();
+    highlighting = true;
+    QTextBlock block = document->findBlockByNumber(first);
+    for(int i = first; i < end && block.isValid(); i++, block = block.next()){
+        QVector<QTextLayout::FormatRange> ranges;
+        const vector<TokenView>& tokens = editorLexer.line(i).tokens;
+        for(vector<TokenView>::const_iterator iter = tokens.begin(); iter != tokens.end(); iter++){
+            QTextLayout::FormatRange range;
+            range.start = iter->offset;
+            range.length = iter->length;
+            range.format = tokenFormat(iter->type);
+            if(range.format.propertyCount() > 0){
+                ranges.push_back(range);
+            }
+        }
+        block.layout()->setFormats(ranges);
+        document->markContentsDirty(block.position(), block.length());
+    }
+    highlighting = false;
+}
+
 /**
  * @brief read production file
  */ 
@@ -179,45 +273,35 @@ void CompilerWidget::readProductionFile(){
 }
 
 /**
- * @brief lexical analyse
+ * @brief lexical and syntax analyse
+ * @details the parser pulls the tokens from the lexer, so the two analyses run together,
+ * 		the compiler tells which of them failed
  */
-void CompilerWidget::lexicalAnalyse(){
+void CompilerWidget::syntaxAnalyse(){
     if(this->compiler->getState() == CompilerState::Error){
         return;
     }
-    // lexical analyse
-    ui.messageBrowser->append("Running lexical analysis...");
+    // lexical and syntax analyse
+    ui.messageBrowser->append("Running lexical and syntax analysis...");
     compiler->lexicalAnalyse();
-    // if the lexical analysis failed, show an error message
-    if(compiler->getErrorMessage() != ""){
-        ui.messageBrowser->append("Error occurs when running lexical analysis, see the error message for details.");
-        // show the error message
-        ui.errorBrowser->append(QString::fromStdString(compiler->getErrorMessage()));
-        QMessageBox::critical(this, tr("Error"), tr("Lexical analysis error"));
-        return;
-    }
-    ui.messageBrowser->append("Successfully run lexical analysis.");
-}
-
-/**
- * @brief syntax analyse
- */
-void CompilerWidget::syntaxAnalyse(){
-    if(this->compiler->getState() == CompilerState::Error){
-        return;
+    if(compiler->getState() != CompilerState::Error){
+        compiler->syntaxAnalyse();
     }
-    // syntax analyse
-    ui.messageBrowser->append("Running syntax analysis...");
-    compiler->syntaxAnalyse();
-    // if the syntax analysis failed, show an error message
+    // if the analysis failed, show an error message
     if(compiler->getErrorMessage() != ""){
-        ui.messageBrowser->append("Error occurs when running syntax analysis, see the error message for details.");
-        // show the error message
-        ui.errorBrowser->append(QString::fromStdString(compiler->getErrorMessage()));
-        QMessageBox::critical(this, tr("Error"), tr("Syntax analysis error"));
+        if(compiler->getFailedStage() == CompilerState::LexicalAnalyse){
+            ui.messageBrowser->append("Error occurs when running lexical analysis, see the error message for details.");
+            ui.errorBrowser->append(QString::fromStdString(compiler->getErrorMessage()));
+            QMessageBox::critical(this, tr("Error"), tr("Lexical analysis error"));
+        }
+        else{
+            ui.messageBrowser->append("Error occurs when running syntax analysis, see the error message for details.");
+            ui.errorBrowser->append(QString::fromStdString(compiler->getErrorMessage()));
+            QMessageBox::critical(this, tr("Error"), tr("Syntax analysis error"));
+        }
         return;
     }
-    ui.messageBrowser->append("Successfully run syntax analysis.");
+    ui.messageBrowser->append("Successfully run lexical and syntax analysis.");
 }
 
 /**
@@ -264,13 +348,14 @@ void CompilerWidget::compile(){
         delete compiler;
     }
     this->compiler = new Compiler("productions.txt");
+    // the stacks of the parse can be shown, so they are recorded
+    compiler->setTracing(true);
 
     // set the source file of the compiler
     compiler->setSourceFile(sourceFile.toStdString());
     // compile
     ui.messageBrowser->append("Compiling...");
     readProductionFile();
-    lexicalAnalyse();
     syntaxAnalyse();
     objectCodeGeneration();
     ui.messageBrowser->append("");
@@ -311,7 +396,7 @@ void CompilerWidget::showTokens(){
 
 /**
  * @brief show state stack
- * @details show the state stack in the info browser, read the state stack from stateStack.txt
+ * @details show the state stack in the info browser, rebuild it from the trace of the last parse
  */
 void CompilerWidget::showStateStack(){
     // if the compiler is not constructed, show an error message
@@ -319,28 +404,23 @@ void CompilerWidget::showStateStack(){
         QMessageBox::critical(this, tr("Error"), tr("Compile the source code first"));
         return;
     }
-    // read state stack from stateStack.txt
     ui.infoBrowser->clear();
     ui.infoBrowser->append("State Stack:");
     ui.infoBrowser->append("");
-    // read file stateStack.txt
-    ifstream in("state.txt", ios::in);
-    if(!in.is_open()){
-        QMessageBox::critical(this, tr("Error"), tr("File state.txt open error"));
-        return;
-    }
+    // the stack of each step is printed only now, from the pushes and pops the parser recorded
+    stringstream in;
+    compiler->outputStateStack(in);
     string line;
     while(getline(in, line)){
         ui.infoBrowser->append(QString::fromStdString(line));
     }
-    in.close();
     // set the name of infotab as "State Stack"
     ui.tabWidget_2->setTabText(1, "State Stack");
 }
 
 /**
  * @brief show symbol stack
- * @details show the symbol stack in the info browser, read the symbol stack from symbolStack.txt
+ * @details show the symbol stack in the info browser, rebuild it from the trace of the last parse
  */
 void CompilerWidget::showSymbolStack(){
     // if the compiler is not constructed, show an error message
@@ -348,21 +428,16 @@ void CompilerWidget::showSymbolStack(){
         QMessageBox::critical(this, tr("Error"), tr("Compile the source code first"));
         return;
     }
-    // read symbol stack from symbolStack.txt
     ui.infoBrowser->clear();
     ui.infoBrowser->append("Symbol Stack:");
     ui.infoBrowser->append("");
-    // read file symbolStack.txt
-    ifstream in("symbol.txt", ios::in);
-    if(!in.is_open()){
-        QMessageBox::critical(this, tr("Error"), tr("File symbol.txt open error"));
-        return;
-    }
+    // the stack of each step is printed only now, from the pushes and pops the parser recorded
+    stringstream in;
+    compiler->outputSymbolStack(in);
     string line;
     while(getline(in, line)){
         ui.infoBrowser->append(QString::fromStdString(line));
     }
-    in.close();
     // set the name of infotab as "Symbol Stack"
     ui.tabWidget_2->setTabText(1, "Symbol Stack");
 }
@@ -483,12 +558,10 @@ void CompilerWidget::showDFA(){
  * @brief destructor
  */
 CompilerWidget::~CompilerWidget() {
-    // delete intermediate.txt, lexical.txt, objectCode.txt, productions.txt, stateStack.txt, symbolStack.txt
+    // delete intermediate.txt, lexical.txt, objectCode.txt, productions.txt
     remove("intermediate.txt");
     remove("lexical.txt");
     remove("object.asm");
-    remove("state.txt");
-    remove("symbol.txt");
     remove("DFA.txt");
     // delete compiler
     if(compiler != nullptr){
@@ -4,8 +4,12 @@
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QMessageBox>
 #include <QTCore/QTextStream>
+#include <QtGui/QTextDocument>
+#include <QtGui/QTextBlock>
+#include <QtGui/QTextLayout>
 #include "ui_CompilerWidget.h"
 #include "compiler.h"
+#include "IncrementalLexer.h"
 
 class CompilerWidget : public QMainWindow
 {
@@ -18,13 +22,17 @@ private:
     Compiler* compiler;
     // source file
     QString sourceFile;
+    // tokens of the source in the editor, kept up to date on every edit
+    IncrementalLexer editorLexer;
+    // the formats of the editor are being changed
+    bool highlighting;
+    // color the tokens of the lines in [first, end)
+    void highlightLines(int first, int end);
     // change source file
     void changeSourceFile(QString sourceFile);
     // read production file
     void readProductionFile();
-    // lexical analyse
-    void lexicalAnalyse();
-    // syntax analyse
+    // lexical and syntax analyse, the parser pulls the tokens
     void syntaxAnalyse();
     // object code generation
     void objectCodeGeneration();
@@ -46,6 +54,8 @@ public slots:
     void compile();
     // when the text in the text edit changed
     void textChanged();
+    // when some chars of the text edit changed, lex the changed lines again
+    void sourceChanged(int position, int charsRemoved, int charsAdded);
     // show Tokens
     void showTokens();
     // show state stack
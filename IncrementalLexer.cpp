@@ -0,0 +1,98 @@
+#include "IncrementalLexer.h"
+
+/**
+ * @brief Construct a new Incremental Lexer object with an empty text
+ */
+IncrementalLexer::IncrementalLexer() {
+	scan = &getScanKernels();
+	setText("");
+}
+
+/**
+ * @brief lex one line
+ * @param line: the line, its tokens are replaced
+ * @param startsInComment: if the line starts inside a paragraph comment
+ * @return true if a paragraph comment is open at the end of the line
+ */
+bool IncrementalLexer::lexLine(LexedLine& line, bool startsInComment) {
+	const char* begin = line.text.data();
+	const char* end = begin + line.text.size();
+	const char* p = begin;
+	int lines = 0;
+	line.startsInComment = startsInComment;
+	line.tokens.clear();
+	// the rest of a paragraph comment from the lines before
+	if (startsInComment) {
+		const char* close = scan->findCommentEnd(p, end);
+		if (close == end) {
+			line.tokens.push_back(TokenView{ PCOMMENT, 0, uint32_t(end - begin), NO_ATOM });
+			line.endsInComment = true;
+			return true;
+		}
+		p = close + 2;
+		line.tokens.push_back(TokenView{ PCOMMENT, 0, uint32_t(p - begin), NO_ATOM });
+	}
+	while ((p = scan->skipSpace(p, end, lines)) != end) {
+		TokenMatch match = LexicalAnalyser::matchToken(*scan, p, end);
+		line.tokens.push_back(TokenView{ match.type, uint32_t(p - begin), uint32_t(match.end - p), NO_ATOM });
+		p = match.end;
+		if (match.unclosed) {
+			line.endsInComment = true;
+			return true;
+		}
+	}
+	line.endsInComment = false;
+	return false;
+}
+
+/**
+ * @brief replace the whole text and lex every line
+ * @param text
+ */
+void IncrementalLexer::setText(const string& text) {
+	vector<string> inserted;
+	size_t start = 0;
+	while (true) {
+		size_t newline = text.find('\n', start);
+		if (newline == string::npos) {
+			inserted.push_back(text.substr(start));
+			break;
+		}
+		inserted.push_back(text.substr(start, newline - start));
+		start = newline + 1;
+	}
+	lines.clear();
+	edit(0, 0, inserted);
+}
+
+/**
+ * @brief replace some lines and lex again the lines whose tokens may have changed
+ * @param first: index of the first changed line
+ * @param removed: number of old lines replaced, from first
+ * @param inserted: the new lines, without '\n'
+ * @return int: one past the last line lexed again, the lines in [first, return) may have new tokens
+ */
+int IncrementalLexer::edit(int first, int removed, const vector<string>& inserted) {
+	vector<LexedLine> newLines(inserted.size());
+	for (size_t i = 0; i < inserted.size(); i++) {
+		newLines[i].text = inserted[i];
+	}
+	lines.erase(lines.begin() + first, lines.begin() + first + removed);
+	lines.insert(lines.begin() + first, newLines.begin(), newLines.end());
+	if (lines.empty()) {
+		lines.push_back(LexedLine());
+	}
+
+	// the comment state at the start of the first line is known from the line before it
+	bool inComment = first > 0 && lines[first - 1].endsInComment;
+	int last = first + (int)inserted.size();
+	int index = first;
+	for (; index < (int)lines.size(); index++) {
+		// after the edited lines, stop as soon as a line starts in the same state as before
+		if (index >= last && lines[index].startsInComment == inComment) {
+			break;
+		}
+		inComment = lexLine(lines[index], inComment);
+	}
+	return index;
+}
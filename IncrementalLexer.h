@@ -0,0 +1,45 @@
+#ifndef INCREMENTALLEXER_H
+#define INCREMENTALLEXER_H
+#include "LexicalAnalyser.h"
+
+/**
+ * @brief the tokens of one line of the editor
+ */
+struct LexedLine {
+	string text;					// the line without '\n'
+	bool startsInComment = false;	// the line starts inside a paragraph comment
+	bool endsInComment = false;		// a paragraph comment is still open at the end of the line
+	vector<TokenView> tokens;		// tokens of the line, the offset is the column, the atom is not set
+};
+
+/**
+ * @brief a lexer for the editor which keeps the tokens of every line and re-lexes only what an edit touches
+ * @author chtholly
+ * @details the tokens of a line depend only on its text and on whether it starts inside a paragraph comment,
+ * 		so a line which starts outside a comment is a restart point for the lexer, and a line which starts
+ * 		inside one is resumed by looking for the closing mark. A comment spanning several lines is cut
+ * 		into one PCOMMENT token per line, an unclosed one runs to the end of the last line.
+ * 		After an edit the changed lines are lexed again, then the following lines as long as the comment
+ * 		state at their start is different from before; the rest of the cache is kept.
+ */
+class IncrementalLexer {
+private:
+	vector<LexedLine> lines;		// all lines of the text, there is always at least one
+	const ScanKernels* scan;		// vectorized scanning loops
+
+	// lex one line, return true if it ends inside a paragraph comment
+	bool lexLine(LexedLine& line, bool startsInComment);
+public:
+	IncrementalLexer();
+	// replace the whole text
+	void setText(const string& text);
+	// replace removed lines from first by the inserted lines, return one past the last line which was lexed again
+	int edit(int first, int removed, const vector<string>& inserted);
+	// getter
+	int lineCount() const { return (int)lines.size(); }
+	const LexedLine& line(int index) const { return lines[index]; }
+	// if the text ends inside a paragraph comment
+	bool unclosedComment() const { return lines.back().endsInComment; }
+};
+
+#endif // !INCREMENTALLEXER_H
@@ -2,26 +2,28 @@
 
 /**
  * @brief Construct a new Intermediate Code:: Intermediate Code object
+ * @param interner: the interner of the compilation, temporaries and labels are interned in it
  */
-IntermediateCode::IntermediateCode() {
+IntermediateCode::IntermediateCode(Interner* interner) {
+	this->interner = interner;
 	tempIndex = 0;
 	labelIndex = 0;
 }
 
 /**
  * @brief Generate a new label
- * @return string : label name
+ * @return Atom : label name
  */
-string IntermediateCode::newLabel() {
-	return string("Label") + to_string(labelIndex++);
+Atom IntermediateCode::newLabel() {
+	return interner->intern(string("Label") + to_string(labelIndex++));
 }
 
 /**
  * @brief Generate a new temporary variable
- * @return string: temporary variable name
+ * @return Atom: temporary variable name
  */
-string IntermediateCode::newTemp() {
-	return string("T") + to_string(tempIndex++);
+Atom IntermediateCode::newTemp() {
+	return interner->intern(string("T") + to_string(tempIndex++));
 }
 
 /**
@@ -34,12 +36,20 @@ int IntermediateCode::nextQuad() {
 
 /**
  * @brief Get the function blocks object
- * @return map<string, vector<Block> >* 
+ * @return map<Atom, vector<Block> >* 
  */
-map<string, vector<Block> >* IntermediateCode::getFuncBlock() {
+map<Atom, vector<Block> >* IntermediateCode::getFuncBlock() {
 	return &funcBlocks;
 }
 
+/**
+ * @brief Get the interner which keeps the text of the atoms in the code
+ * @return Interner* 
+ */
+Interner* IntermediateCode::getInterner() {
+	return interner;
+}
+
 /**
  * @brief Generate a new quaternary
  * @param q 
@@ -55,18 +65,53 @@ void IntermediateCode::_emit(Quaternary q) {
  * @param src2 
  * @param des 
  */
-void IntermediateCode::_emit(string op, string src1, string src2, string des) {
+void IntermediateCode::_emit(Atom op, Atom src1, Atom src2, Atom des) {
 	_emit(Quaternary{ op,src1,src2,des });
 }
 
+/**
+ * @brief Make a backpatch list of one jump
+ * @param quad: the jump
+ * @return PatchList
+ */
+PatchList IntermediateCode::makeList(int quad) {
+	if ((int)patchNext.size() <= quad) {
+		patchNext.resize(quad + 1, -1);
+	}
+	patchNext[quad] = -1;
+	return PatchList{ quad,quad };
+}
+
+/**
+ * @brief Merge two backpatch lists, the jumps of the first one come first
+ * @details the lists are linked, so neither can be used on its own afterwards
+ * @param first
+ * @param second
+ * @return PatchList
+ */
+PatchList IntermediateCode::mergeList(PatchList first, PatchList second) {
+	if (first.head == -1) {
+		return second;
+	}
+	if (second.head == -1) {
+		return first;
+	}
+	patchNext[first.tail] = second.head;
+	return PatchList{ first.head,second.tail };
+}
+
 /**
  * @brief Back patch the quaternary
  * @param nextList 
  * @param quad 
  */
-void IntermediateCode::back_patch(list<int>nextList, int quad) {
-	for (list<int>::iterator iter = nextList.begin(); iter != nextList.end(); iter++) {
-		code[*iter].des = to_string(quad);
+void IntermediateCode::back_patch(PatchList nextList, int quad) {
+	if (nextList.head == -1) {
+		return;
+	}
+	Atom target = interner->intern(to_string(quad));
+	for (int i = nextList.head; i != -1; i = patchNext[i]) {
+		code[i].des = target;
 	}
 }
 
@@ -74,9 +119,9 @@ void IntermediateCode::back_patch(list<int>nextList, int quad) {
  * @brief Divide basic blocks for each function
  * @param funcEnter: function enter points
  */
-void IntermediateCode::divideBlocks(vector<pair<int, pair<string,DType>>> funcEnter) {
+void IntermediateCode::divideBlocks(vector<pair<int, pair<Atom,DType>>> funcEnter) {
 	// traverse all functions enter points
-	for (vector<pair<int, pair<string,DType>>>::iterator iter = funcEnter.begin(); iter != funcEnter.end(); iter++) {
+	for (vector<pair<int, pair<Atom,DType>>>::iterator iter = funcEnter.begin(); iter != funcEnter.end(); iter++) {
 		// all basic blocks
 		vector<Block>blocks;
 		// get the enter points of each block
@@ -90,35 +135,35 @@ void IntermediateCode::divideBlocks(vector<pair<int, pair<string,DType>>> funcEn
 		int returnValueIndex = -1;
 		for (int i = iter->first; i != endIndex; i++) {
 			// jump instruction
-			if (code[i].op[0] == 'j') {
+			if (isJumpOp(code[i].op)) {
 				// unconditional jump, push the jump target as the enter point
-				if (code[i].op == "j") {
-					block_enter.push(atoi(code[i].des.c_str()));
+				if (code[i].op == ATOM_J) {
+					block_enter.push(atoi(interner->text(code[i].des).c_str()));
 				}
 				// conditional jump, push the next instruction and the jump target as the enter point
 				else {
 					if (i + 1 < endIndex) {
 						block_enter.push(i + 1);
 					}
-					block_enter.push(atoi(code[i].des.c_str()));
+					block_enter.push(atoi(interner->text(code[i].des).c_str()));
 				}
 			}
 			// return or call instruction, push the next instruction as the enter point
-			else if (code[i].op == "return" || code[i].op == "call") {
+			else if (code[i].op == ATOM_RETURN || code[i].op == ATOM_CALL) {
 				if (i + 1 < endIndex) {
 					block_enter.push(i + 1);
 				}
 			}
 
 			// check return
-			if (code[i].op == "return") {
+			if (code[i].op == ATOM_RETURN) {
 				hasReturn = true;
-				if (code[i].src1 == "_" && iter->second.second != DType::D_VOID) {
-					outputError("function " + iter->second.first + " expect a INT type return value, but got VOID");
+				if (code[i].src1 == ATOM_BLANK && iter->second.second != DType::D_VOID) {
+					outputError("function " + interner->text(iter->second.first) + " expect a INT type return value, but got VOID");
 					return;
 				}
-				else if(code[i].src1 != "_" && iter->second.second == DType::D_VOID){
-					outputError("function " + iter->second.first + " expect a VOID type return value, but got INT");
+				else if(code[i].src1 != ATOM_BLANK && iter->second.second == DType::D_VOID){
+					outputError("function " + interner->text(iter->second.first) + " expect a VOID type return value, but got INT");
 					return;
 				}
 			}
@@ -126,7 +171,7 @@ void IntermediateCode::divideBlocks(vector<pair<int, pair<string,DType>>> funcEn
 
 		// if the function has no return instruction, report error
 		if (!hasReturn) {
-			outputError("function " + iter->second.first + " has no return instruction");
+			outputError("function " + interner->text(iter->second.first) + " has no return instruction");
 			return;
 		}
 
@@ -134,7 +179,7 @@ void IntermediateCode::divideBlocks(vector<pair<int, pair<string,DType>>> funcEn
 		//devide blocks
 		Block block;
 		// map from label to enter point
-		map<int, string>labelEnter;
+		map<int, Atom>labelEnter;
 		// map from enter point to block index
 		map<int, int>enter_block;
 		// the first block of a function, name is the function name
@@ -199,23 +244,24 @@ void IntermediateCode::divideBlocks(vector<pair<int, pair<string,DType>>> funcEn
 		for (vector<Block>::iterator bIter = blocks.begin(); bIter != blocks.end(); bIter++, blockIndex++) {
 			vector<Quaternary>::reverse_iterator lastCode = bIter->codes.rbegin();
 			// if the last instruction is a jump instruction
-			if (lastCode->op[0] == 'j') {
+			if (isJumpOp(lastCode->op)) {
+				int target = atoi(interner->text(lastCode->des).c_str());
 				// if the jump instruction is unconditional jump, set the next block as the jump target
-				if (lastCode->op == "j") {
-					bIter->next1 = enter_block[atoi(lastCode->des.c_str())];
+				if (lastCode->op == ATOM_J) {
+					bIter->next1 = enter_block[target];
 					bIter->next2 = -1;
 				}
 				// if the jump instruction is conditional jump, set the next block as the next instruction and the jump target
 				else {
 					bIter->next1 = blockIndex + 1;
-					bIter->next2 = enter_block[atoi(lastCode->des.c_str())];
+					bIter->next2 = enter_block[target];
 					bIter->next2 = bIter->next1 == bIter->next2 ? -1 : bIter->next2;
 				}
 				// set the jump target as the label
-				lastCode->des = labelEnter[atoi(lastCode->des.c_str())];
+				lastCode->des = labelEnter[target];
 			}
 			// if the last instruction is a return instruction, set the next block as -1
-			else if (lastCode->op == "return") {
+			else if (lastCode->op == ATOM_RETURN) {
 				bIter->next1 = bIter->next2 = -1;
 			}
 			// other instructions, set the next block as the next instruction
@@ -235,12 +281,12 @@ void IntermediateCode::divideBlocks(vector<pair<int, pair<string,DType>>> funcEn
  * @param out: output stream
  */
 void IntermediateCode::outputBlocks(ostream& out) {
-	for (map<string, vector<Block> >::iterator iter = funcBlocks.begin(); iter != funcBlocks.end(); iter++) {
-		out << "[" << iter->first << "]" << endl;
+	for (map<Atom, vector<Block> >::iterator iter = funcBlocks.begin(); iter != funcBlocks.end(); iter++) {
+		out << "[" << interner->text(iter->first) << "]" << endl;
 		for (vector<Block>::iterator bIter = iter->second.begin(); bIter != iter->second.end(); bIter++) {
-			out << bIter->name << ":" << endl;
+			out << interner->text(bIter->name) << ":" << endl;
 			for (vector<Quaternary>::iterator cIter = bIter->codes.begin(); cIter != bIter->codes.end(); cIter++) {
-				out <<"    "<< "(" << cIter->op << "," << cIter->src1 << "," << cIter->src2 << "," << cIter->des << ")" << endl;
+				out <<"    "<< "(" << interner->text(cIter->op) << "," << interner->text(cIter->src1) << "," << interner->text(cIter->src2) << "," << interner->text(cIter->des) << ")" << endl;
 			}
 			out << "    " << "next1 = " << bIter->next1 << endl;
 			out << "    " << "next2 = " << bIter->next2 << endl;
@@ -280,10 +326,10 @@ void IntermediateCode::output(ostream& out) {
 	int i = 0;
 	for (vector<Quaternary>::iterator iter = code.begin(); iter != code.end(); iter++, i++) {
 		out << setw(4) << i;
-		out << "( " << iter->op << " , ";
-		out << iter->src1 << " , ";
-		out << iter->src2 << " , ";
-		out << iter->des << " )";
+		out << "( " << interner->text(iter->op) << " , ";
+		out << interner->text(iter->src1) << " , ";
+		out << interner->text(iter->src2) << " , ";
+		out << interner->text(iter->des) << " )";
 		out << endl;
 	}
 }
@@ -1,22 +1,36 @@
 #pragma once
 #include "utils.h"
+#include "Interner.h"
 
 /**
- * @brief the type of Quaternary
+ * @brief the type of Quaternary, every field is an atom of the interner
  */
 struct Quaternary {
-	string op;					// operator
-	string src1;				// source operator1
-	string src2;				// source operator2
-	string des;					// destination quaternary
+	Atom op;					// operator
+	Atom src1;					// source operator1
+	Atom src2;					// source operator2
+	Atom des;					// destination quaternary
 };
 
 
+/**
+ * @brief a backpatch list, the jumps waiting for the same target
+ * @details the list is threaded through the jumps, IntermediateCode keeps the jump after each one,
+ * 		so a list is the first and the last of its jumps and two lists are merged by one link. -1 for none.
+ */
+struct PatchList {
+	int head;					// the first jump
+	int tail;					// the last jump
+};
+
+// a list without jumps
+static const PatchList EMPTY_PATCH_LIST = { -1, -1 };
+
 /**
  * @brief the type of code block
  */
 struct Block {
-	string name; 				// block name
+	Atom name; 					// block name
 	vector<Quaternary> codes; 	// contain a list of quaternary
 	int next1;					// next block index
 	int next2;
@@ -24,25 +38,30 @@ struct Block {
 
 class IntermediateCode {
 private:
+	Interner* interner;						// interner of the compilation
 	vector<Quaternary> code;				// generated intermediate code
-	map<string, vector<Block> >funcBlocks;	// function blocks
+	vector<int> patchNext;					// the next jump of the backpatch list of each jump, -1 for the last
+	map<Atom, vector<Block> >funcBlocks;	// function blocks
 	int tempIndex;							// index of temporary variable
 	int labelIndex;							// index of label
 
 	void output(ostream& out);
 	void outputBlocks(ostream& out);
 public:
-	IntermediateCode();
-	string newLabel();
-	string newTemp();
+	IntermediateCode(Interner* interner);
+	Atom newLabel();
+	Atom newTemp();
 	void _emit(Quaternary q);
-	void _emit(string op, string src1, string src2, string des);
-	void back_patch(list<int>nextList,int quad);
+	void _emit(Atom op, Atom src1, Atom src2, Atom des);
+	PatchList makeList(int quad);
+	PatchList mergeList(PatchList first, PatchList second);
+	void back_patch(PatchList nextList, int quad);
 	void output();
 	void output(const char* fileName);
-	void divideBlocks(vector<pair<int, pair<string,DType>>> funcEnter);
+	void divideBlocks(vector<pair<int, pair<Atom,DType>>> funcEnter);
 	void outputBlocks();
 	void outputBlocks(const char* fileName);
-	map<string, vector<Block> >*getFuncBlock();
+	map<Atom, vector<Block> >*getFuncBlock();
+	Interner* getInterner();
 	int nextQuad();
 };
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "Interner.h"
+#include "TerminalTable.h"
+
+// the texts of the preset atoms, in the order of PresetAtom
+static const char* presetTexts[PRESET_ATOM_COUNT] = {
+	"", "_", "j", "j>", "j>=", "j<", "j<=", "j==", "j!=", "+", "-", "*", "/", "=",
+	"par", "call", "return", "get", "@RETURN_PLACE",
+	"$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7", "$v0"
+};
+
+/**
+ * @brief Construct a new Interner object with the preset atoms and the terminals
+ */
+Interner::Interner() {
+	clear();
+}
+
+/**
+ * @brief forget all atoms, then intern the presets and the spellings of the terminals again
+ */
+void Interner::clear() {
+	texts.clear();
+	heads.clear();
+	hashes.clear();
+	slots.assign(256, NO_ATOM);
+	for (Atom i = 0; i < PRESET_ATOM_COUNT; i++) {
+		intern(presetTexts[i], strlen(presetTexts[i]));
+	}
+	for (int i = 0; i <= EMPTY; i++) {
+		terminals[i] = NO_ATOM;
+	}
+	for (size_t i = 0; i < TERMINAL_COUNT; i++) {
+		if (terminalKeys[i].lexeme) {
+			terminals[terminalKeys[i].type] = intern(terminalKeys[i].text, terminalKeys[i].length);
+		}
+	}
+}
+
+/**
+ * @brief FNV-1a hash of a text
+ */
+uint32_t Interner::hash(const char* text, size_t length) {
+	uint32_t h = 2166136261u;
+	for (size_t i = 0; i < length; i++) {
+		h = (h ^ (unsigned char)text[i]) * 16777619u;
+	}
+	return h;
+}
+
+/**
+ * @brief get the atom of a text
+ * @param text: the text, does not need to be terminated by 0
+ * @param length: the length of the text
+ * @return Atom: the atom of the text, a new atom if the text has not been interned
+ */
+Atom Interner::intern(const char* text, size_t length) {
+	uint32_t h = hash(text, length);
+	size_t mask = slots.size() - 1;
+	for (size_t slot = h & mask; ; slot = (slot + 1) & mask) {
+		Atom atom = slots[slot];
+		if (atom == NO_ATOM) {
+			return insert(text, length, h, slot);
+		}
+		if (hashes[atom] == h && texts[atom].size() == length && memcmp(texts[atom].data(), text, length) == 0) {
+			return atom;
+		}
+	}
+}
+
+Atom Interner::intern(const string& text) {
+	return intern(text.data(), text.size());
+}
+
+/**
+ * @brief look a text up without interning it
+ * @param text: the text, does not need to be terminated by 0
+ * @param length: the length of the text
+ * @return Atom: the atom of the text, NO_ATOM if the text has not been interned
+ */
+Atom Interner::find(const char* text, size_t length) const {
+	uint32_t h = hash(text, length);
+	size_t mask = slots.size() - 1;
+	for (size_t slot = h & mask; ; slot = (slot + 1) & mask) {
+		Atom atom = slots[slot];
+		if (atom == NO_ATOM || (hashes[atom] == h && texts[atom].size() == length && memcmp(texts[atom].data(), text, length) == 0)) {
+			return atom;
+		}
+	}
+}
+
+/**
+ * @brief add a new atom into an empty slot of the table
+ */
+Atom Interner::insert(const char* text, size_t length, uint32_t h, size_t slot) {
+	Atom atom = (Atom)texts.size();
+	texts.push_back(string(text, length));
+	heads.push_back(length > 0 ? text[0] : '\0');
+	hashes.push_back(h);
+	slots[slot] = atom;
+	// keep the table at most half full
+	if (texts.size() * 2 > slots.size()) {
+		grow();
+	}
+	return atom;
+}
+
+/**
+ * @brief double the hash table and put every atom into its new slot
+ */
+void Interner::grow() {
+	slots.assign(slots.size() * 2, NO_ATOM);
+	size_t mask = slots.size() - 1;
+	for (Atom atom = 0; atom < (Atom)texts.size(); atom++) {
+		size_t slot = hashes[atom] & mask;
+		while (slots[slot] != NO_ATOM) {
+			slot = (slot + 1) & mask;
+		}
+		slots[slot] = atom;
+	}
+}
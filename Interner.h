@@ -0,0 +1,106 @@
+#ifndef INTERNER_H
+#define INTERNER_H
+#include "utils.h"
+#include "Token.h"
+
+/**
+ * @file Interner.h
+ * @brief the string interner of one compilation
+ * @author chtholly
+ * @details every name of the program (identifiers, numbers, temporaries, labels, operators, registers)
+ * 		is interned once and passed around as an Atom, so the parser, the intermediate code and the
+ * 		object code generator compare and hash 32-bit integers instead of strings.
+ * 		The same text always gets the same atom; the text of an atom never moves.
+ */
+
+/**
+ * @brief atoms which exist in every interner, their text is in the comment
+ * @details the jumps and the registers are kept together so that they can be checked by a range
+ */
+enum PresetAtom : Atom {
+	ATOM_EMPTY,					// ""
+	ATOM_BLANK,					// "_", an unused field of a quaternary
+	ATOM_J,						// "j"
+	ATOM_JGT,					// "j>"
+	ATOM_JGE,					// "j>="
+	ATOM_JLT,					// "j<"
+	ATOM_JLE,					// "j<="
+	ATOM_JEQ,					// "j=="
+	ATOM_JNE,					// "j!="
+	ATOM_ADD,					// "+"
+	ATOM_SUB,					// "-"
+	ATOM_MUL,					// "*"
+	ATOM_DIV,					// "/"
+	ATOM_ASSIGN,				// "="
+	ATOM_PAR,					// "par"
+	ATOM_CALL,					// "call"
+	ATOM_RETURN,				// "return"
+	ATOM_GET,					// "get"
+	ATOM_RETURN_PLACE,			// "@RETURN_PLACE", the return value of the last call
+	ATOM_REG_S0,				// "$s0" .. "$s7", the registers given to variables
+	ATOM_REG_S7 = ATOM_REG_S0 + 7,
+	ATOM_REG_V0,				// "$v0", the return value
+	PRESET_ATOM_COUNT
+};
+
+// no atom, never given out by an interner
+#define NO_ATOM ((Atom)0xFFFFFFFF)
+
+/**
+ * @brief if the atom is a jump operator, j and j<cond>
+ */
+inline bool isJumpOp(Atom op) {
+	return op >= ATOM_J && op <= ATOM_JNE;
+}
+
+/**
+ * @brief if the atom is a control operator, a jump, call, return or get
+ */
+inline bool isControlOp(Atom op) {
+	return isJumpOp(op) || op == ATOM_CALL || op == ATOM_RETURN || op == ATOM_GET;
+}
+
+/**
+ * @brief if the atom is a register
+ */
+inline bool isRegister(Atom atom) {
+	return atom >= ATOM_REG_S0 && atom <= ATOM_REG_V0;
+}
+
+/**
+ * @brief the string interner
+ */
+class Interner {
+private:
+	deque<string> texts;			// text of each atom, a deque does not move its elements
+	vector<char> heads;				// first char of each atom, to tell variables from numbers quickly
+	vector<uint32_t> hashes;		// hash of each atom, used when the table grows
+	vector<Atom> slots;				// open addressing hash table of the atoms, NO_ATOM for an empty slot
+	Atom terminals[EMPTY + 1];		// atom of the spelling of each terminal token type
+
+	static uint32_t hash(const char* text, size_t length);
+	Atom insert(const char* text, size_t length, uint32_t h, size_t slot);
+	void grow();
+public:
+	Interner();
+	Interner(const Interner&) = delete;
+	Interner& operator=(const Interner&) = delete;
+	// forget all atoms except the presets
+	void clear();
+	// the atom of a text, a new one if the text has not been seen
+	Atom intern(const char* text, size_t length);
+	Atom intern(const string& text);
+	// the atom of a text which has been interned, NO_ATOM if it has not
+	Atom find(const char* text, size_t length) const;
+	// the text of an atom
+	const string& text(Atom atom) const { return texts[atom]; }
+	// the atom of the spelling of a terminal, NO_ATOM for comments and errors
+	Atom terminal(TokenType type) const { return terminals[type]; }
+	// a variable starts with a letter, a number with a digit
+	bool isVar(Atom atom) const { return isalpha((unsigned char)heads[atom]) != 0; }
+	bool isNum(Atom atom) const { return isdigit((unsigned char)heads[atom]) != 0; }
+	// number of atoms
+	size_t size() const { return texts.size(); }
+};
+
+#endif // !INTERNER_H
@@ -1,18 +1,28 @@
 #include "LexicalAnalyser.h"
+#include "LexerTables.h"
+#include "TerminalTable.h"
+#include <thread>
 
 /**
  * @brief Construct a new Lexical Analyser:: Lexical Analyser object
  * @author: chtholly
  * @param path: the path of the source file
+ * @param interner: the interner of the compilation, it gives the atoms of the tokens
+ * @param mode: map the source file or read it into memory
  */
-LexicalAnalyser::LexicalAnalyser(const char* path) {
-	lineCount = 0;
-	src.open(path, ios::in);
+LexicalAnalyser::LexicalAnalyser(const char* path, Interner* interner, SourceMode mode) {
+	this->interner = interner;
+	lineCount = 1;
+	scan = &getScanKernels();
+	setThreads(0);
 	// failed to open the source file
-	if (!src.is_open()) {
+	if (!src.open(path, mode)) {
 		cerr << "file " << path << " open error" << endl;
 		exit(-1);
 	}
+	cur = src.begin();
+	lastOffset = 0;
+	tokens.reset(src.begin(), src.end(), scan);
 }
 
 /**
@@ -20,200 +30,451 @@ LexicalAnalyser::LexicalAnalyser(const char* path) {
  * @author: chtholly
  */
 LexicalAnalyser::~LexicalAnalyser() {
-	if (src.is_open()) {
-		src.close();
+	if (echo.is_open()) {
+		echo.close();
 	}
+	src.close();
 }
 
 /**
- * @brief read the source, get the next char and ignore the space and tab
+ * @brief skip the space, tab and new line, get the next char
  * @author chtholly
- * @return char 
+ * @return char: the next char, it is not consumed. 0 at the end of the file
  */
 char LexicalAnalyser::getChar() {
-	char nextChar;
-	while (src >> nextChar) {
-		// linecount++ when the next char is '\n'
-		if (nextChar == '\n') {
-			lineCount++;
-		}
-		// ignore the space and tab
-		if (nextChar == ' '|| nextChar=='\t') {
-			continue;
+	cur = scan->skipSpace(cur, src.end(), lineCount);
+	// read the end of the file
+	if (cur == src.end()) {
+		return 0;
+	}
+	return *cur;
+}
+
+/**
+ * @brief make a token view from the begin of the lexeme to the current position
+ * @details identifiers and numbers are interned here, the other tokens have the preset atom of their spelling
+ * @param type: the type of the token
+ * @param begin: the first char of the lexeme
+ * @return TokenView
+ */
+TokenView LexicalAnalyser::makeToken(TokenType type, const char* begin) {
+	Atom atom = type == ID || type == NUM ? interner->intern(begin, cur - begin) : interner->terminal(type);
+	return TokenView{ type, uint32_t(begin - src.begin()), uint32_t(cur - begin), atom };
+}
+
+/**
+ * @brief make an error token, the message can not be a view so it is stored in errorText
+ * @param begin: the first char of the wrong lexeme
+ * @param message: the error message
+ * @return TokenView
+ */
+TokenView LexicalAnalyser::makeError(const char* begin, string message) {
+	errorText = message;
+	return makeToken(ERROR, begin);
+}
+
+/**
+ * @brief match the longest token at begin
+ * @details run the DFA generated from tokens.txt and take the longest lexeme it accepts,
+ * 		the accepting state gives the type of the token directly, keywords are found in the terminal hash table.
+ * 		It does not look at anything before begin, so it can also be run on a part of the source, like one line.
+ * @param scan: the scanning kernels
+ * @param begin: the first char of the token, not a space
+ * @param end: the end of the input
+ * @return TokenMatch: ERROR and one char if no token starts at begin
+ */
+TokenMatch LexicalAnalyser::matchToken(const ScanKernels& scan, const char* begin, const char* end) {
+	char nextChar = *begin;
+
+	// the long tokens are scanned many bytes a time, they must agree with the rules in tokens.txt
+	// identifier or keyword
+	if ((nextChar | 0x20) >= 'a' && (nextChar | 0x20) <= 'z') {
+		const char* tokenEnd = scan.skipIdentifier(begin + 1, end);
+		const TerminalEntry* keyword = lookupTerminal(begin, tokenEnd - begin);
+		if (keyword != nullptr && keyword->lexeme) {
+			return TokenMatch{ keyword->type, tokenEnd, false };
 		}
-		return nextChar;
+		return TokenMatch{ ID, tokenEnd, false };
 	}
-	// read the end of the file
-	return 0;
+	// number
+	if (nextChar >= '0' && nextChar <= '9') {
+		return TokenMatch{ NUM, scan.skipDigits(begin + 1, end), false };
+	}
+	if (nextChar == '/' && end - begin >= 2) {
+		// line comment, till the end of the line
+		if (begin[1] == '/') {
+			const char* newline = (const char*)memchr(begin + 2, '\n', end - begin - 2);
+			return TokenMatch{ LCOMMENT, newline == nullptr ? end : newline, false };
+		}
+		// paragraph comment, till the first */
+		if (begin[1] == '*') {
+			const char* close = scan.findCommentEnd(begin + 2, end);
+			if (close == end) {
+				return TokenMatch{ PCOMMENT, end, true };
+			}
+			return TokenMatch{ PCOMMENT, close + 2, false };
+		}
+	}
+
+	// other tokens, run the DFA and take the end and type of the longest accepted lexeme
+	const char* acceptEnd = nullptr;
+	TokenType acceptType = ERROR;
+	LexState state = LEX_START_STATE;
+	const char* p = begin;
+	while (p != end) {
+		state = lexTransition[state][lexCharClass[(unsigned char)*p]];
+		if (state == LEX_DEAD_STATE) {
+			break;
+		}
+		p++;
+		if (lexAccept[state] != ERROR) {
+			acceptEnd = p;
+			acceptType = lexAccept[state];
+		}
+	}
+
+	// the DFA is still running at the end of the input, a paragraph comment is not closed
+	if (p == end && state != LEX_DEAD_STATE && end - begin >= 2 && begin[0] == '/' && begin[1] == '*') {
+		return TokenMatch{ PCOMMENT, end, true };
+	}
+	// no token starts with this char
+	if (acceptEnd == nullptr) {
+		return TokenMatch{ ERROR, begin + 1, false };
+	}
+	// a keyword is spelled like an identifier
+	if (acceptType == ID) {
+		const TerminalEntry* keyword = lookupTerminal(begin, acceptEnd - begin);
+		if (keyword != nullptr && keyword->lexeme) {
+			acceptType = keyword->type;
+		}
+	}
+	return TokenMatch{ acceptType, acceptEnd, false };
 }
 
 /**
  * @brief get the next token from the source file
  * @author chtholly
- * @return Token 
+ * @return TokenView
  */
-Token LexicalAnalyser::getToken(){
+TokenView LexicalAnalyser::getToken(){
 	char nextChar = getChar();
-	
-	switch (nextChar) {
-		// the characters needed to read next
-		case 0:
-			return Token("#");
-			break;
-		case '=':
-			if (src.peek() == '=') {
-				src.get();
-				return Token("==");
-			}
-			else {
-				return Token("=");
-			}
-			break;
-		case '>':
-			if (src.peek() == '=') {
-				src.get();
-				return Token(">=");
-			}
-			else {
-				return Token(">");
-			}
-			break;
-		case '<':
-			if (src.peek() == '=') {
-				src.get();
-				return Token("<=");
-			}
-			else {
-				return Token("<");
-			}
+	const char* begin = cur;
+	if (nextChar == 0) {
+		return makeToken(ENDFILE, begin);
+	}
+
+	TokenMatch match = matchToken(*scan, begin, src.end());
+	cur = match.end;
+	if (match.unclosed) {
+		return makeError(begin, string("unclose paragraph comment in line ") + to_string(lineCount));
+	}
+	// no token starts with this char
+	if (match.type == ERROR) {
+		return makeError(begin, string("Lexical analyser detected unknow Token ") + nextChar + string("in line ") + to_string(lineCount));
+	}
+	// only a paragraph comment can span lines
+	if (match.type == PCOMMENT) {
+		lineCount += scan->countNewlines(begin, cur);
+	}
+	return makeToken(match.type, begin);
+}
+
+/**
+ * @brief analyse the source file and store the result in the token views
+ * @author chtholly
+ */
+void LexicalAnalyser::analyse() {
+	if (analysesInParallel()) {
+		analyseParallel();
+		return;
+	}
+	while (true) {
+		TokenView t = getToken();
+		if(t.type!=EMPTY)
+			tokens.push(t.type, t.offset, t.atom);
+		if (t.type == ERROR) {
+			outputError(errorText);
+			return;
+		}
+		else if (t.type == ENDFILE) {
 			break;
-		case '!':
-			if (src.peek() == '=') {
-				src.get();
-				return Token("!=");
+		}
+	}
+}
+
+/**
+ * @brief whether analyse() cuts the source into chunks lexed in several threads
+ * @return true if there are several threads and the source is large enough
+ */
+bool LexicalAnalyser::analysesInParallel() {
+	return threadCount > 1 && src.size() >= parallelMinSize;
+}
+
+/**
+ * @brief the tokens of one chunk of the source
+ * @details a chunk starts after a '\n', so only a paragraph comment can run into it from the chunks before.
+ * 		The chunk is lexed as if it starts outside a comment, and again as if it starts inside one;
+ * 		the second run stops as soon as it reaches a token start of the first, the rest is the same.
+ * 		The offsets are from the begin of the source. Identifiers and numbers have the atoms of the local interner.
+ */
+struct LexChunk {
+	const char* begin;					// first char of the chunk
+	const char* end;					// one past the last char
+	vector<TokenView> tokens;			// lexed from outside a comment
+	bool endsInComment = false;			// the last of tokens is a paragraph comment open at the end of the chunk
+	vector<TokenView> commentTokens;	// lexed from inside a comment, the first one is the rest of the comment
+	size_t joinIndex = SIZE_MAX;		// commentTokens go on with tokens[joinIndex..], SIZE_MAX if they never meet
+	bool commentEndsInComment = false;	// a comment is open at the end when commentTokens never meet tokens
+	Interner local;						// the interner of the chunk, the threads can not share one
+	Atom firstAtom = 0;					// the atoms of local below it are the presets, the same in every interner
+};
+
+/**
+ * @brief lex from p to the end of a chunk, outside comments
+ * @param join: stop when a token starts where one of these starts, nullptr to lex to the end
+ * @param joinIndex: set to the index in join where the lexing stopped
+ * @return true if a paragraph comment is open at the end
+ */
+static bool lexChunkRange(const ScanKernels& scan, const char* base, const char* p, const char* end, Interner& interner,
+	vector<TokenView>& out, const vector<TokenView>* join, size_t& joinIndex) {
+	int lines = 0;
+	size_t j = 0;
+	while ((p = scan.skipSpace(p, end, lines)) != end) {
+		uint32_t offset = uint32_t(p - base);
+		if (join != nullptr) {
+			while (j < join->size() && (*join)[j].offset < offset) {
+				j++;
 			}
-			else {
-				return Token(ERROR, string("Lexical analyser detected unknow Token ") + nextChar + string("in line ") + to_string(lineCount));
+			if (j < join->size() && (*join)[j].offset == offset) {
+				joinIndex = j;
+				return false;
 			}
+		}
+		// getChar() takes a 0 char as the end of the file
+		if (*p == '\0') {
+			out.push_back(TokenView{ ENDFILE, offset, 0, interner.terminal(ENDFILE) });
+			return false;
+		}
+		TokenMatch match = LexicalAnalyser::matchToken(scan, p, end);
+		Atom atom = match.type == ID || match.type == NUM ? interner.intern(p, match.end - p) : interner.terminal(match.type);
+		out.push_back(TokenView{ match.type, offset, uint32_t(match.end - p), atom });
+		p = match.end;
+		if (match.unclosed) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief lex one chunk in both states, run by a worker thread
+ * @param first: the first chunk, it can only start outside a comment
+ */
+static void lexChunk(const ScanKernels& scan, const char* base, LexChunk& chunk, bool first) {
+	size_t joinIndex = SIZE_MAX;
+	chunk.firstAtom = (Atom)chunk.local.size();
+	chunk.endsInComment = lexChunkRange(scan, base, chunk.begin, chunk.end, chunk.local, chunk.tokens, nullptr, joinIndex);
+	if (first) {
+		return;
+	}
+	const char* close = scan.findCommentEnd(chunk.begin, chunk.end);
+	if (close == chunk.end) {
+		chunk.commentTokens.push_back(TokenView{ PCOMMENT, uint32_t(chunk.begin - base), uint32_t(chunk.end - chunk.begin), NO_ATOM });
+		chunk.commentEndsInComment = true;
+		return;
+	}
+	chunk.commentTokens.push_back(TokenView{ PCOMMENT, uint32_t(chunk.begin - base), uint32_t(close + 2 - chunk.begin), NO_ATOM });
+	chunk.commentEndsInComment = lexChunkRange(scan, base, close + 2, chunk.end, chunk.local, chunk.commentTokens, &chunk.tokens, chunk.joinIndex);
+}
+
+/**
+ * @brief analyse the source in several threads
+ * @details the source is cut after a '\n' into one chunk per thread, and the chunks are lexed at the same time.
+ * 		Then the chunks are joined in order: the state at the end of a chunk tells which of its two results the next one takes,
+ * 		a comment open at the end of a chunk is joined with the rest of it at the begin of the next.
+ * 		The atoms of the chunks are interned again in the order of the tokens, so every token and atom is the same as
+ * 		when the source is lexed by one thread; the tokens stop at the first error as well.
+ * @author chtholly
+ */
+void LexicalAnalyser::analyseParallel() {
+	const char* base = src.begin();
+	const char* end = src.end();
+	size_t size = src.size();
+
+	// cut the source after the first '\n' from every n-th part
+	vector<const char*> cuts(1, base);
+	for (int i = 1; i < threadCount; i++) {
+		const char* p = base + size / threadCount * i;
+		if (p <= cuts.back()) {
+			continue;
+		}
+		const char* newline = (const char*)memchr(p, '\n', end - p);
+		if (newline == nullptr) {
 			break;
-		// comment or divide
-		case '/':
-			//line comment
-			if (src.peek() == '/') {
-				char buf[1024];
-				src.getline(buf, 1024);
-				return Token(LCOMMENT, string("/")+buf);
+		}
+		cuts.push_back(newline + 1);
+	}
+	cuts.push_back(end);
+	vector<LexChunk> chunks(cuts.size() - 1);
+	for (size_t i = 0; i < chunks.size(); i++) {
+		chunks[i].begin = cuts[i];
+		chunks[i].end = cuts[i + 1];
+	}
+
+	// lex the chunks, the first one in this thread
+	vector<thread> workers;
+	for (size_t i = 1; i < chunks.size(); i++) {
+		workers.push_back(thread(lexChunk, std::cref(*scan), base, std::ref(chunks[i]), false));
+	}
+	lexChunk(*scan, base, chunks[0], true);
+	for (size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+
+	// join the chunks
+	tokens.reset(src.begin(), src.end(), scan);
+	bool inComment = false;
+	for (size_t i = 0; i < chunks.size(); i++) {
+		LexChunk& chunk = chunks[i];
+		// the new atoms of the local interner, given a global atom at their first use
+		vector<Atom> atoms(chunk.local.size() - chunk.firstAtom, NO_ATOM);
+		const TokenView* parts[2][2] = { { nullptr, nullptr }, { nullptr, nullptr } };
+		bool endsInComment;
+		if (!inComment) {
+			parts[1][0] = chunk.tokens.data();
+			parts[1][1] = chunk.tokens.data() + chunk.tokens.size();
+			endsInComment = chunk.endsInComment;
+		}
+		else {
+			parts[0][0] = chunk.commentTokens.data();
+			parts[0][1] = chunk.commentTokens.data() + chunk.commentTokens.size();
+			endsInComment = chunk.commentEndsInComment;
+			if (chunk.joinIndex != SIZE_MAX) {
+				parts[1][0] = chunk.tokens.data() + chunk.joinIndex;
+				parts[1][1] = chunk.tokens.data() + chunk.tokens.size();
+				endsInComment = chunk.endsInComment;
 			}
-			//paragraph comment
-			else if (src.peek() == '*') {
-				src.get();
-				string buf = "/*";
-				while (src >> nextChar) {
-					buf += nextChar;
-					if (nextChar == '*') {
-						src >> nextChar;
-						buf += nextChar;
-						if (nextChar == '/') {
-							return Token(PCOMMENT, buf);
-							break;
-						}
-					}
-				}
-				// unclose paragraph comment
-				if (src.eof()) {
-					return Token(ERROR, string("unclose paragraph comment in line ") + to_string(lineCount));
+		}
+		for (int part = 0; part < 2; part++) {
+			for (const TokenView* t = parts[part][0]; t != parts[part][1]; t++) {
+				// the rest of the comment open at the end of the chunk before, the comment is one token
+				if (part == 0 && t == parts[0][0]) {
+					continue;
 				}
-			}
-			//divide
-			else {
-				return Token("/");
-			}
-			break;
-		// other characters
-		default:
-			// read number
-			if (isdigit(nextChar)) {
-				string buf;
-				buf.push_back(nextChar);
-				while (nextChar=src.peek()) {
-					if (isdigit(nextChar)) {
-						src >> nextChar;
-						buf += nextChar;
-					}
-					else {
-						break;
+				TokenView token = *t;
+				if ((token.type == ID || token.type == NUM) && token.atom >= chunk.firstAtom) {
+					Atom& atom = atoms[token.atom - chunk.firstAtom];
+					if (atom == NO_ATOM) {
+						atom = interner->intern(chunk.local.text(token.atom));
 					}
+					token.atom = atom;
 				}
-				// this token is a NUMBER
-				return Token(NUM, buf);
-			}
-			// read identifier
-			else if (isalpha(nextChar)) {
-				string buf;
-				buf.push_back(nextChar);
-				while (nextChar = src.peek()) {
-					if (isdigit(nextChar)||isalpha(nextChar)) {
-						src >> nextChar;
-						buf += nextChar;
-					}
-					else {
-						break;
-					}
+				tokens.push(token.type, token.offset, token.atom);
+				if (token.type == ERROR) {
+					lineCount = 1 + (int)scan->countNewlines(base, base + token.offset);
+					errorText = string("Lexical analyser detected unknow Token ") + base[token.offset] + string("in line ") + to_string(lineCount);
+					outputError(errorText);
+					return;
+				}
+				if (token.type == ENDFILE) {
+					return;
 				}
-				// might be a keyword or a identifier
-				return Token(buf);
-			}
-			// any other characters
-			else {
-				Token tmp = Token(string("").append(1, nextChar));
-				if(tmp.getType()==ERROR)
-					return Token(ERROR, string("Lexical analyser detected unknow Token ") + nextChar + string("in line ") + to_string(lineCount));
-				else
-					return tmp;
 			}
+		}
+		inComment = endsInComment;
 	}
-	// unkown error
-	return Token(ERROR, "UNKOWN ERROR");
+
+	// a paragraph comment is not closed at the end of the source
+	if (inComment) {
+		size_t comment = tokens.size() - 1;
+		lineCount = 1 + (int)scan->countNewlines(base, base + tokens.offset(comment));
+		errorText = string("unclose paragraph comment in line ") + to_string(lineCount);
+		tokens.setType(comment, ERROR);
+		outputError(errorText);
+		return;
+	}
+	tokens.push(ENDFILE, uint32_t(size));
 }
 
 /**
- * @brief analyse the source file and store the result in the result list
- * @author chtholly
+ * @brief pull the next token from the source
+ * @details the token is written into the echo file if there is one, the file is closed at the end of the source
+ * @return Token: the token, ENDFILE at the end of the source
  */
-void LexicalAnalyser::analyse() {
-	while (true) {
-		Token t = getToken();
-		if(t.getType()!=EMPTY)
-			result.push_back(t);
-		if (t.getType() == ERROR) {
-			outputError(t.getValue());
-			return;
-		}
-		else if (t.getType() == ENDFILE) {
-			break;
+Token LexicalAnalyser::next() {
+	TokenView t = getToken();
+	lastOffset = t.offset;
+	if (echo.is_open()) {
+		outputToken(echo, t);
+		if (t.type == ERROR || t.type == ENDFILE) {
+			echo.close();
 		}
 	}
+	return Token(t.type, t.atom);
+}
+
+/**
+ * @brief get the error message of the last ERROR token
+ * @return string
+ */
+string LexicalAnalyser::getErrorText() {
+	return errorText;
+}
+
+/**
+ * @brief whether the lexer has made an ERROR token
+ * @return true if there is an error, its message is getErrorText()
+ */
+bool LexicalAnalyser::hasError() {
+	return !errorText.empty();
+}
+
+/**
+ * @brief get the line and column of the last token pulled by next()
+ * @return SourcePosition
+ */
+SourcePosition LexicalAnalyser::position() {
+	return tokens.position(lastOffset);
+}
+
+/**
+ * @brief write the tokens pulled by next() into a file
+ * @param fileName
+ */
+void LexicalAnalyser::echoToFile(const char* fileName) {
+	echo.open(fileName, ios::out);
+	if (!echo.is_open()) {
+		cerr << "file " << fileName << " open error" << endl;
+	}
+}
+
+/**
+ * @brief write one token, a line ends after ; and {
+ * @param out
+ * @param token
+ */
+void LexicalAnalyser::outputToken(ostream& out, const TokenView& token) {
+	out << tokenTypeName(token.type) << "  " << getText(token);
+	if (token.type == SEMI || token.type == LBRACE || token.type == ERROR) {
+		out << endl;
+	}
+	else {
+		out << string(" ");
+	}
 }
 
 /**
  * @brief output the analyse result to the screen or file
  * @author chtholly
- * @param out 
+ * @param out
  */
 void LexicalAnalyser::outputToStream(ostream&out) {
-	if (result.back().getType() == ERROR) {
-		out << result.back().toString() <<endl;
+	if (tokens.type(tokens.size() - 1) == ERROR) {
+		outputToken(out, tokenAt(tokens.size() - 1));
 	}
 	else {
-		list<Token>::iterator iter;
-		for (iter = result.begin(); iter != result.end(); iter++) {
-			out << (*iter).toString();
-			if ((*iter).getType() == SEMI || (*iter).getType() == LBRACE) {
-				out << endl;
-			}
-			else {
-				out << string(" ");
-			}
+		for (size_t i = 0; i < tokens.size(); i++) {
+			outputToken(out, tokenAt(i));
 		}
 	}
 }
@@ -225,7 +486,7 @@ void LexicalAnalyser::outputToScreen() {
 /**
  * @brief output the analyse result to the file named fileName
  * @author chtholly
- * @param fileName 
+ * @param fileName
  */
 void LexicalAnalyser::outputToFile(const char *fileName) {
 	ofstream fout;
@@ -239,10 +500,58 @@ void LexicalAnalyser::outputToFile(const char *fileName) {
 }
 
 /**
- * @brief get the analyse result list of the source file
- * @author chtholly
- * @return list<Token>& 
+ * @brief choose the instruction set of the scanning kernels, the best one is used by default
+ * @param level
+ */
+void LexicalAnalyser::setScanLevel(ScanLevel level) {
+	scan = &getScanKernels(level);
+}
+
+/**
+ * @brief choose the number of threads used by analyse()
+ * @param count: number of threads, 0 for one per core, 1 to analyse in the calling thread
+ * @param minSize: sources smaller than this are analysed in the calling thread
  */
-list<Token>&LexicalAnalyser::getResult() {
-	return result;
-}
\ No newline at end of file
+void LexicalAnalyser::setThreads(int count, size_t minSize) {
+	if (count <= 0) {
+		count = (int)thread::hardware_concurrency();
+	}
+	threadCount = count > 0 ? count : 1;
+	parallelMinSize = minSize;
+}
+
+/**
+ * @brief get the analyse result
+ * @return const TokenBuffer&
+ */
+const TokenBuffer& LexicalAnalyser::getTokens() {
+	return tokens;
+}
+
+/**
+ * @brief get one token of the analyse result as a view, its length and atom are found again
+ * @param index
+ * @return TokenView
+ */
+TokenView LexicalAnalyser::tokenAt(size_t index) {
+	TokenType type = tokens.type(index);
+	uint32_t length = tokens.length(index);
+	Atom atom = type == ID || type == NUM ? interner->find(src.begin() + tokens.offset(index), length) : interner->terminal(type);
+	return TokenView{ type, tokens.offset(index), length, atom };
+}
+
+/**
+ * @brief get the text of a token
+ * @details the end of file token is spelled "#" in the grammar, the error token carries the error message
+ * @param token
+ * @return string
+ */
+string LexicalAnalyser::getText(const TokenView& token) {
+	if (token.type == ENDFILE) {
+		return "#";
+	}
+	if (token.type == ERROR) {
+		return errorText;
+	}
+	return string(src.begin() + token.offset, token.length);
+}
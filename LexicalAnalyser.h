@@ -1,35 +1,105 @@
 #pragma once
 #include "Token.h"
 #include "utils.h"
+#include "SourceBuffer.h"
+#include "ScanKernels.h"
+#include "Interner.h"
+#include "TokenStream.h"
+#include "TokenBuffer.h"
+
+/**
+ * @brief the longest token found at some position
+ */
+struct TokenMatch {
+	TokenType type;				// type of the token, ERROR if no token starts there
+	const char* end;			// one past the last char of the token
+	bool unclosed;				// a paragraph comment runs to the end of the input without */
+};
+
+// sources smaller than this are always lexed by one thread
+#define PARALLEL_LEX_MIN_SIZE (4 << 20)
 
 /**
  * @brief lexical analyser
  * @author chtholly
- * @details analyse the source file and output the result as a list of tokens
+ * @details the source is scanned in memory, every token is a view (type, offset, length) into the source buffer,
+ * 		so lexing does not allocate anything per token. Positions are not tracked while lexing, an error message
+ * 		finds the line and column of its token from the offset. Identifiers and numbers are interned as they are scanned,
+ * 		the parser only sees their atoms.
+ * 		The parser pulls the tokens through next() one at a time and nothing is kept, so the memory used by the
+ * 		lexer does not grow with the source. analyse() scans the whole source into views for the tools which want all of them.
+ * 		A large source is cut at line ends into one chunk per thread and analysed in parallel, see analyseParallel().
+ * 		The compiler lexes such a source with analyse() and parses it from the buffer, see TokenBufferStream,
+ * 		the tokens then take five bytes each, and four more for an identifier or a number.
  */
-class LexicalAnalyser {
+class LexicalAnalyser :public TokenStream {
 private:
 	// the source file
-	ifstream src;
-	// result, a list of tokens
-	list<Token> result;
+	SourceBuffer src;
+	// the current scan position in the source
+	const char* cur;
+	// vectorized scanning loops
+	const ScanKernels* scan;
+	// the interner of the compilation
+	Interner* interner;
+	// result of analyse(), the type and offset of each token
+	TokenBuffer tokens;
+	// offset of the last token pulled by next()
+	uint32_t lastOffset;
+	// the tokens pulled by next() are written into this file
+	ofstream echo;
+	// the error message of the ERROR token
+	string errorText;
 	// the current line number
 	int lineCount;
+	// number of threads of analyse(), 1 to analyse in the calling thread
+	int threadCount;
+	// sources smaller than this are analysed in the calling thread
+	size_t parallelMinSize;
 private:
-	// read the source, get the next char and ignore the space and tab
+	// skip the space, tab and new line, return the next char or 0 at the end of the file
 	char getChar();
 	// read from the source and get the next token
-	Token getToken();
+	TokenView getToken();
+	// make a token from the begin of the lexeme to the current position
+	TokenView makeToken(TokenType type, const char* begin);
+	// make an error token, the message is kept in errorText
+	TokenView makeError(const char* begin, string message);
+	// write one token in the format of the result file
+	void outputToken(ostream& out, const TokenView& token);
 	// output the result to the stream
 	void outputToStream(ostream&out);
+	// analyse the source by chunks in several threads, the result is the same as the serial one
+	void analyseParallel();
 public:
 	// constructor
-	LexicalAnalyser(const char* path);
+	LexicalAnalyser(const char* path, Interner* interner, SourceMode mode = SourceMode::Map);
 	~LexicalAnalyser();
-	// analyse the source file
+	// analyse the whole source file
 	void analyse();
+	// analyse() would use several threads
+	bool analysesInParallel();
+	// pull the next token, see TokenStream
+	Token next();
+	string getErrorText();
+	// an ERROR token has been made
+	bool hasError();
+	SourcePosition position();
+	// write every token pulled by next() into the file, in the format of outputToFile
+	void echoToFile(const char* fileName);
+	// choose the instruction set of the scanning loops
+	void setScanLevel(ScanLevel level);
+	// choose the number of threads of analyse(), 0 for one per core
+	void setThreads(int count, size_t minSize = PARALLEL_LEX_MIN_SIZE);
 	// result output
 	void outputToScreen();
 	void outputToFile(const char *fileName);
-	list<Token>&getResult();
+	// the tokens of analyse()
+	const TokenBuffer& getTokens();
+	// one token of analyse() as a view into the source
+	TokenView tokenAt(size_t index);
+	// match the longest token at begin, begin must not be a space
+	static TokenMatch matchToken(const ScanKernels& scan, const char* begin, const char* end);
+	// the text of a token
+	string getText(const TokenView& token);
 };
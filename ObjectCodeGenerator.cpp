@@ -51,14 +51,28 @@ QuaternaryWithInfo::QuaternaryWithInfo(Quaternary q, VarInfomation info1, VarInf
  * @brief output the information
  * @param out 
  */
-void QuaternaryWithInfo::output(ostream& out) {
-	out << "(" << q.op << "," << q.src1 << "," << q.src2 << "," << q.des << ")";
+void QuaternaryWithInfo::output(ostream& out, const Interner& interner) {
+	out << "(" << interner.text(q.op) << "," << interner.text(q.src1) << "," << interner.text(q.src2) << "," << interner.text(q.des) << ")";
 	info1.output(out);
 	info2.output(out);
 	info3.output(out);
 }
 
-ObjectCodeGenerator::ObjectCodeGenerator() {}
+/**
+ * @brief Construct a new Object Code Generator:: Object Code Generator object
+ * @param interner: the interner of the compilation, the intermediate code is made of its atoms
+ */
+ObjectCodeGenerator::ObjectCodeGenerator(Interner* interner) {
+	this->interner = interner;
+	this->mainFunc = interner->intern("main");
+}
+
+/**
+ * @brief the text of an atom, to write it into the object code
+ */
+const string& ObjectCodeGenerator::text(Atom atom) {
+	return interner->text(atom);
+}
 
 /**
  * @brief store a register in a location
@@ -66,16 +80,16 @@ ObjectCodeGenerator::ObjectCodeGenerator() {}
  * @param var: the variable name
  * @details generating the code: sw $reg offset($sp), offset = varOffset[var]
  */
-void ObjectCodeGenerator::storeVar(string reg, string var) {
+void ObjectCodeGenerator::storeVar(Atom reg, Atom var) {
 	// there is already space for var in the stack
 	if (varOffset.find(var) != varOffset.end()) {
-		objectCodes.push_back(string("sw ") + reg + " " + to_string(varOffset[var]) + "($sp)");
+		objectCodes.push_back(string("sw ") + text(reg) + " " + to_string(varOffset[var]) + "($sp)");
 	}
 	// there is no space for var in the stack, store
 	else {
 		varOffset[var] = top;
 		top += 4;
-		objectCodes.push_back(string("sw ") + reg + " " + to_string(varOffset[var]) + "($sp)");
+		objectCodes.push_back(string("sw ") + text(reg) + " " + to_string(varOffset[var]) + "($sp)");
 	}
 	// the Avalue of var contains itself and the register
 	Avalue[var].insert(var);
@@ -85,14 +99,14 @@ void ObjectCodeGenerator::storeVar(string reg, string var) {
  * @brief release a variable from a register
  * @param var: the variable name, indicating a memory location
  */
-void ObjectCodeGenerator::releaseVar(string var) {
+void ObjectCodeGenerator::releaseVar(Atom var) {
 	// for all the registers which store var, release var from the register
-	for (set<string>::iterator iter = Avalue[var].begin(); iter != Avalue[var].end(); iter++) {
+	for (set<Atom>::iterator iter = Avalue[var].begin(); iter != Avalue[var].end(); iter++) {
 		// if the register is a real register, not a the variable itself
-		if ((*iter)[0] == '$') {
+		if (isRegister(*iter)) {
 			Rvalue[*iter].erase(var);
 			// if the register is empty, add it to the free register list
-			if (Rvalue[*iter].size() == 0 && (*iter)[1] == 's') {
+			if (Rvalue[*iter].size() == 0 && *iter <= ATOM_REG_S7) {
 				freeReg.push_back(*iter);
 			}
 		}
@@ -103,11 +117,11 @@ void ObjectCodeGenerator::releaseVar(string var) {
 
 /**
  * @brief select a register for a variable
- * @return string: the register name
+ * @return Atom: the register name
  */
-string ObjectCodeGenerator::selectReg() {
+Atom ObjectCodeGenerator::selectReg() {
 	// if there is a free register, return it
-	string ret;
+	Atom ret = ATOM_EMPTY;
 	if (freeReg.size()) {
 		ret = freeReg.back();
 		freeReg.pop_back();
@@ -121,14 +135,14 @@ string ObjectCodeGenerator::selectReg() {
 	 */
 	int maxNextPos = 0;
 	// traverse all the registers
-	for (map<string, set<string> >::iterator iter = Rvalue.begin(); iter != Rvalue.end(); iter++) {
+	for (map<Atom, set<Atom> >::iterator iter = Rvalue.begin(); iter != Rvalue.end(); iter++) {
 		int nextpos = INT32_MAX;
 		// traverse all the variables stored in the register
-		for (set<string>::iterator viter = iter->second.begin(); viter != iter->second.end(); viter++) {
+		for (set<Atom>::iterator viter = iter->second.begin(); viter != iter->second.end(); viter++) {
 			// if the variable is not stored in other places
 			bool inFlag = false;
 			// traverse all the places where these variable is stored
-			for (set<string>::iterator aiter = Avalue[*viter].begin(); aiter != Avalue[*viter].end(); aiter++) {
+			for (set<Atom>::iterator aiter = Avalue[*viter].begin(); aiter != Avalue[*viter].end(); aiter++) {
 				// if the variable is not only stored in this register, set inFlag to true
 				if (*aiter != iter->first) {
 					inFlag = true;
@@ -165,7 +179,7 @@ string ObjectCodeGenerator::selectReg() {
 	/**
 	 * @brief for all the variables stored in the selected register, release them from the register
 	 */
-	for (set<string>::iterator iter = Rvalue[ret].begin(); iter != Rvalue[ret].end(); iter++) {
+	for (set<Atom>::iterator iter = Rvalue[ret].begin(); iter != Rvalue[ret].end(); iter++) {
 		// realse the selected register from Avalue of the variables stored in it
 		Avalue[*iter].erase(ret);
 		// if these variables are also stored in other places, we do not need to write them back in the memory
@@ -214,28 +228,28 @@ string ObjectCodeGenerator::selectReg() {
 /**
  * @brief allocate a register for a variable
  * @param var: the variable name
- * @return string: the allocated register name
+ * @return Atom: the allocated register name
  */
-string ObjectCodeGenerator::allocateReg(string var) {
+Atom ObjectCodeGenerator::allocateReg(Atom var) {
 	// if the variable is not in the memory(immidiate number), store it in a register directly
-	if (isNum(var)) {
-		string ret = selectReg();
-		objectCodes.push_back(string("addi ") + ret + " $zero " + var);
+	if (interner->isNum(var)) {
+		Atom ret = selectReg();
+		objectCodes.push_back(string("addi ") + text(ret) + " $zero " + text(var));
 		return ret;
 	}
 
 	// if the variable already has a register, return the register
-	for (set<string>::iterator iter = Avalue[var].begin(); iter != Avalue[var].end(); iter++) {
+	for (set<Atom>::iterator iter = Avalue[var].begin(); iter != Avalue[var].end(); iter++) {
 		// if the variable is stored in a register
-		if ((*iter)[0] == '$') {
+		if (isRegister(*iter)) {
 			return *iter;
 		}
 	}
 
 	// otherwise, select a register for the variable
-	string ret = selectReg();
+	Atom ret = selectReg();
 	// load the variable from the memory
-	objectCodes.push_back(string("lw ") + ret + " " + to_string(varOffset[var]) + "($sp)");
+	objectCodes.push_back(string("lw ") + text(ret) + " " + to_string(varOffset[var]) + "($sp)");
 	// update the Avalue and Rvalue
 	Avalue[var].insert(ret);
 	Rvalue[ret].insert(var);
@@ -248,13 +262,13 @@ string ObjectCodeGenerator::allocateReg(string var) {
  * 		1. if the source operand 1 is a variable, and it is only stored in a register, allocate the register to the destination operand
  * 		2. otherwise, realloc a register for the destination operand
  */
-string ObjectCodeGenerator::getReg() {
+Atom ObjectCodeGenerator::getReg() {
 	// if source operand 1 a variable
-	if (!isNum(nowQuatenary->q.src1)) {
+	if (!interner->isNum(nowQuatenary->q.src1)) {
 		// traverse all the registers that store the source operand 1
-		set<string>&src1pos = Avalue[nowQuatenary->q.src1];
-		for (set<string>::iterator iter = src1pos.begin(); iter != src1pos.end(); iter++) {
-			if ((*iter)[0] == '$') {
+		set<Atom>&src1pos = Avalue[nowQuatenary->q.src1];
+		for (set<Atom>::iterator iter = src1pos.begin(); iter != src1pos.end(); iter++) {
+			if (isRegister(*iter)) {
 				// if this register only stores the source operand 1, allocate it to the destination operand
 				if (Rvalue[*iter].size() == 1) {
 					if (nowQuatenary->q.des == nowQuatenary->q.src1 || !nowQuatenary->info1.active) {
@@ -268,7 +282,7 @@ string ObjectCodeGenerator::getReg() {
 	}
 
 	// allocate a register for the destination operand
-	string ret = selectReg();
+	Atom ret = selectReg();
 	Avalue[nowQuatenary->q.des].insert(ret);
 	Rvalue[ret].insert(nowQuatenary->q.des);
 	return ret;
@@ -278,9 +292,9 @@ string ObjectCodeGenerator::getReg() {
  * @brief analyse the basic blocks of each function
  * @param funcBlocks: the basic blocks of each function, we can get the intermediate code of each function from it
  */
-void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
+void ObjectCodeGenerator::analyseBlock(map<Atom, vector<Block> >*funcBlocks) {
 	// traverse all the functions
-	for (map<string, vector<Block> >::iterator fbiter = funcBlocks->begin(); fbiter != funcBlocks->end(); fbiter++) {
+	for (map<Atom, vector<Block> >::iterator fbiter = funcBlocks->begin(); fbiter != funcBlocks->end(); fbiter++) {
 		vector<BlockWithInfo> iBlocks;
 		vector<Block>& blocks = fbiter->second;
 		// outlive, inlive, def, use
@@ -288,39 +302,39 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 		// inlive: the in live variables of each basic block
 		// def: the variables defined in each basic block
 		// use: the variables used in each basic block
-		vector<set<string> >INL, OUTL, DEF, USE;
+		vector<set<Atom> >INL, OUTL, DEF, USE;
 
 		// find the DEF and USE set of each basic block
 		// traverse all the basic blocks of this function
 		for (vector<Block>::iterator biter = blocks.begin(); biter != blocks.end(); biter++) {
-			set<string>def, use;
+			set<Atom>def, use;
 			// traverse all the quaternaries in the current basic block
 			for (vector<Quaternary>::iterator citer = biter->codes.begin(); citer != biter->codes.end(); citer++) {
 				// if the quaternary is a jump or a function call, pass
-				if (citer->op == "j" || citer->op == "call") {
+				if (citer->op == ATOM_J || citer->op == ATOM_CALL) {
 					continue;
 				}
 				// if the quaternary is a conditional jump
 				// if operator is a variable, and it is not defined before, add it to the use set
-				else if (citer->op[0] == 'j') {
-					if (isVar(citer->src1) && def.count(citer->src1) == 0) {
+				else if (isJumpOp(citer->op)) {
+					if (interner->isVar(citer->src1) && def.count(citer->src1) == 0) {
 						use.insert(citer->src1);
 					}
-					if (isVar(citer->src2) && def.count(citer->src2) == 0) {
+					if (interner->isVar(citer->src2) && def.count(citer->src2) == 0) {
 						use.insert(citer->src2);
 					}
 				}
 				// if it is a normal assignment
 				else {
 					// if the source operand 1 and 2 is a variable, and it is not defined before, add it to the use set
-					if (isVar(citer->src1) && def.count(citer->src1) == 0) {
+					if (interner->isVar(citer->src1) && def.count(citer->src1) == 0) {
 						use.insert(citer->src1);
 					}
-					if (isVar(citer->src2) && def.count(citer->src2) == 0) {
+					if (interner->isVar(citer->src2) && def.count(citer->src2) == 0) {
 						use.insert(citer->src2);
 					}
 					// if the destination operand is a variable, and it is not used before, add it to the def set
-					if (isVar(citer->des) && use.count(citer->des) == 0) {
+					if (interner->isVar(citer->des) && use.count(citer->des) == 0) {
 						def.insert(citer->des);
 					}
 				}
@@ -331,7 +345,7 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 			DEF.push_back(def);
 			USE.push_back(use);
 			// no outlive variable at the beginning
-			OUTL.push_back(set<string>());
+			OUTL.push_back(set<Atom>());
 		}
 
 		// find the outlive and inlive variables of each basic block
@@ -347,7 +361,7 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 				// analyse the next basic block of the current basic block
 				if (next1 != -1) {
 					// traverse all the outlive variables of the next basic block
-					for (set<string>::iterator inlIter = INL[next1].begin(); inlIter != INL[next1].end(); inlIter++) {
+					for (set<Atom>::iterator inlIter = INL[next1].begin(); inlIter != INL[next1].end(); inlIter++) {
 						// insert the inlive variables of the next basic block into the outlive variables of the current basic block
 						if (OUTL[blockIndex].insert(*inlIter).second == true) {
 							// if the variable is not defined in the current basic block, insert it into the inlive variables of the current basic block
@@ -360,7 +374,7 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 				}
 				// same as above
 				if (next2 != -1) {
-					for (set<string>::iterator inlIter = INL[next2].begin(); inlIter != INL[next2].end(); inlIter++) {
+					for (set<Atom>::iterator inlIter = INL[next2].begin(); inlIter != INL[next2].end(); inlIter++) {
 						if (OUTL[blockIndex].insert(*inlIter).second == true) {
 							if (DEF[blockIndex].count(*inlIter) == 0) {
 								INL[blockIndex].insert(*inlIter);
@@ -389,33 +403,33 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 		}
 
 		// there is a variable table for each basic block
-		vector<map<string, VarInfomation> > symTables;
+		vector<unordered_map<Atom, VarInfomation> > symTables;
 		for (vector<Block>::iterator biter = blocks.begin(); biter != blocks.end(); biter++) {
 			// initialize the variable table for each basic block
-			map<string, VarInfomation>symTable;
+			unordered_map<Atom, VarInfomation>symTable;
 			// add all the variables in the quaternary into the variable table
 			for (vector<Quaternary>::iterator citer = biter->codes.begin(); citer != biter->codes.end(); citer++) {
 	
-				if (citer->op == "j" || citer->op == "call") {
+				if (citer->op == ATOM_J || citer->op == ATOM_CALL) {
 					continue;
 				}
 			
-				else if (citer->op[0] == 'j') {//j>= j<=,j==,j!=,j>,j<
-					if (isVar(citer->src1)) {
+				else if (isJumpOp(citer->op)) {//j>= j<=,j==,j!=,j>,j<
+					if (interner->isVar(citer->src1)) {
 						symTable[citer->src1] = VarInfomation{ -1,false };
 					}
-					if (isVar(citer->src2)) {
+					if (interner->isVar(citer->src2)) {
 						symTable[citer->src2] = VarInfomation{ -1,false };
 					}
 				}
 				else {
-					if (isVar(citer->src1)) {
+					if (interner->isVar(citer->src1)) {
 						symTable[citer->src1] = VarInfomation{ -1,false };
 					}
-					if (isVar(citer->src2)) {
+					if (interner->isVar(citer->src2)) {
 						symTable[citer->src2] = VarInfomation{ -1,false };
 					}
-					if (isVar(citer->des)) {
+					if (interner->isVar(citer->des)) {
 						symTable[citer->des] = VarInfomation{ -1,false };
 					}
 				}
@@ -425,8 +439,8 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 
 		// for every basic block, set the variables in the outlive variables as active in its variable table
 		int blockIndex = 0;
-		for (vector<set<string> >::iterator iter = OUTL.begin(); iter != OUTL.end(); iter++, blockIndex++) {
-			for (set<string>::iterator viter = iter->begin(); viter != iter->end(); viter++) {
+		for (vector<set<Atom> >::iterator iter = OUTL.begin(); iter != OUTL.end(); iter++, blockIndex++) {
+			for (set<Atom>::iterator viter = iter->begin(); viter != iter->end(); viter++) {
 				symTables[blockIndex][*viter] = VarInfomation{ -1,true };
 			}
 
@@ -438,16 +452,16 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 			int codeIndex = ibiter->codes.size() - 1;
 			// traverse all the quaternaries in the current basic block in reverse order
 			for (vector<QuaternaryWithInfo>::reverse_iterator citer = ibiter->codes.rbegin(); citer != ibiter->codes.rend(); citer++, codeIndex--) {//逆序遍历基本块中的代码
-				if (citer->q.op == "j" || citer->q.op == "call") {
+				if (citer->q.op == ATOM_J || citer->q.op == ATOM_CALL) {
 					continue;
 				}
 				// the conditional jump, the source operand 1 and 2 is active, and it will be used in this code
-				else if (citer->q.op[0] == 'j') {
-					if (isVar(citer->q.src1)) {
+				else if (isJumpOp(citer->q.op)) {
+					if (interner->isVar(citer->q.src1)) {
 						citer->info1 = symTables[blockIndex][citer->q.src1];
 						symTables[blockIndex][citer->q.src1] = VarInfomation{ codeIndex,true };
 					}
-					if (isVar(citer->q.src2)) {
+					if (interner->isVar(citer->q.src2)) {
 						citer->info2 = symTables[blockIndex][citer->q.src2];
 						symTables[blockIndex][citer->q.src2] = VarInfomation{ codeIndex,true };
 					}
@@ -456,15 +470,15 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
 				// if the source operand 1 is a variable, and it is active, and it will be used in this code
 				// for the destination operand, set it as inactive
 				else {
-					if (isVar(citer->q.src1)) {
+					if (interner->isVar(citer->q.src1)) {
 						citer->info1 = symTables[blockIndex][citer->q.src1];
 						symTables[blockIndex][citer->q.src1] = VarInfomation{ codeIndex,true };
 					}
-					if (isVar(citer->q.src2)) {
+					if (interner->isVar(citer->q.src2)) {
 						citer->info2 = symTables[blockIndex][citer->q.src2];
 						symTables[blockIndex][citer->q.src2] = VarInfomation{ codeIndex,true };
 					}
-					if (isVar(citer->q.des)) {
+					if (interner->isVar(citer->q.des)) {
 						citer->info3 = symTables[blockIndex][citer->q.des];
 						symTables[blockIndex][citer->q.des] = VarInfomation{ -1,false };
 					}
@@ -481,13 +495,13 @@ void ObjectCodeGenerator::analyseBlock(map<string, vector<Block> >*funcBlocks) {
  * @brief store all the outlive variables in the memory at the end of each block
  * @param outl 
  */
-void ObjectCodeGenerator::storeOutLiveVar(set<string>&outl) {
+void ObjectCodeGenerator::storeOutLiveVar(set<Atom>&outl) {
 	// tranverse all locations where a outlive variable is stored
-	for (set<string>::iterator oiter = outl.begin(); oiter != outl.end(); oiter++) {
-		string reg;
+	for (set<Atom>::iterator oiter = outl.begin(); oiter != outl.end(); oiter++) {
+		Atom reg = ATOM_EMPTY;
 		bool inFlag = false;
-		for (set<string>::iterator aiter = Avalue[*oiter].begin(); aiter != Avalue[*oiter].end(); aiter++) {
-			if ((*aiter)[0] != '$') {
+		for (set<Atom>::iterator aiter = Avalue[*oiter].begin(); aiter != Avalue[*oiter].end(); aiter++) {
+			if (!isRegister(*aiter)) {
 				inFlag = true;
 				break;
 			}
@@ -508,43 +522,43 @@ void ObjectCodeGenerator::storeOutLiveVar(set<string>&outl) {
  * @param arg_num: the number of arguments
  * @param par_list: the list of parameters
  */
-void ObjectCodeGenerator::generateCodeForQuatenary(int nowBaseBlockIndex, int &arg_num, list<pair<string, bool> > &par_list) {
+void ObjectCodeGenerator::generateCodeForQuatenary(int nowBaseBlockIndex, int &arg_num, list<pair<Atom, bool> > &par_list) {
 	// if the source operand is not initialized, output error
-	if (nowQuatenary->q.op[0] != 'j'&&nowQuatenary->q.op != "call") {
-		if (isVar(nowQuatenary->q.src1) && Avalue[nowQuatenary->q.src1].empty()) {
-			outputError(string("variable ") + nowQuatenary->q.src1 + " is not initialized before use");
+	if (!isJumpOp(nowQuatenary->q.op) && nowQuatenary->q.op != ATOM_CALL) {
+		if (interner->isVar(nowQuatenary->q.src1) && Avalue[nowQuatenary->q.src1].empty()) {
+			outputError(string("variable ") + text(nowQuatenary->q.src1) + " is not initialized before use");
 			return;
 		}
-		if (isVar(nowQuatenary->q.src2) && Avalue[nowQuatenary->q.src2].empty()) {
-			outputError(string("variable ") + nowQuatenary->q.src2 + " is not initialized before use");
+		if (interner->isVar(nowQuatenary->q.src2) && Avalue[nowQuatenary->q.src2].empty()) {
+			outputError(string("variable ") + text(nowQuatenary->q.src2) + " is not initialized before use");
 			return;
 		}
 	}
 
 	// jump instruction
 	// unconditional jump
-	if (nowQuatenary->q.op == "j") {
-		objectCodes.push_back(nowQuatenary->q.op + " " + nowQuatenary->q.des);
+	if (nowQuatenary->q.op == ATOM_J) {
+		objectCodes.push_back(text(nowQuatenary->q.op) + " " + text(nowQuatenary->q.des));
 	}
 	// conditional jump
-	else if (nowQuatenary->q.op[0] == 'j') {
+	else if (isJumpOp(nowQuatenary->q.op)) {
 		string op;
-		if (nowQuatenary->q.op == "j>=")
+		if (nowQuatenary->q.op == ATOM_JGE)
 			op = "bge";
-		else if (nowQuatenary->q.op == "j>")
+		else if (nowQuatenary->q.op == ATOM_JGT)
 			op = "bgt";
-		else if (nowQuatenary->q.op == "j==")
+		else if (nowQuatenary->q.op == ATOM_JEQ)
 			op = "beq";
-		else if (nowQuatenary->q.op == "j!=")
+		else if (nowQuatenary->q.op == ATOM_JNE)
 			op = "bne";
-		else if (nowQuatenary->q.op == "j<")
+		else if (nowQuatenary->q.op == ATOM_JLT)
 			op = "blt";
-		else if (nowQuatenary->q.op == "j<=")
+		else if (nowQuatenary->q.op == ATOM_JLE)
 			op = "ble";
 		// allocate a register to the source operand 1 and 2
-		string pos1 = allocateReg(nowQuatenary->q.src1);
-		string pos2 = allocateReg(nowQuatenary->q.src2);
-		objectCodes.push_back(op + " " + pos1 + " " + pos2 + " " + nowQuatenary->q.des);
+		Atom pos1 = allocateReg(nowQuatenary->q.src1);
+		Atom pos2 = allocateReg(nowQuatenary->q.src2);
+		objectCodes.push_back(op + " " + text(pos1) + " " + text(pos2) + " " + text(nowQuatenary->q.des));
 		// if the source is not active, release it from the register
 		if (!nowQuatenary->info1.active) {
 			releaseVar(nowQuatenary->q.src1);
@@ -554,17 +568,17 @@ void ObjectCodeGenerator::generateCodeForQuatenary(int nowBaseBlockIndex, int &a
 		}
 	}
 	// a parameter in a function call
-	else if (nowQuatenary->q.op == "par") {
-		par_list.push_back(pair<string, bool>(nowQuatenary->q.src1, nowQuatenary->info1.active));
+	else if (nowQuatenary->q.op == ATOM_PAR) {
+		par_list.push_back(pair<Atom, bool>(nowQuatenary->q.src1, nowQuatenary->info1.active));
 	}
 	// function call
-	else if (nowQuatenary->q.op == "call") {
+	else if (nowQuatenary->q.op == ATOM_CALL) {
 		// store all the parameters into the stack
-		for (list<pair<string, bool> >::iterator aiter = par_list.begin(); aiter != par_list.end(); aiter++) {
+		for (list<pair<Atom, bool> >::iterator aiter = par_list.begin(); aiter != par_list.end(); aiter++) {
 			// get the input argument
-			string pos = allocateReg(aiter->first);
+			Atom pos = allocateReg(aiter->first);
 			// push it into the stack
-			objectCodes.push_back(string("sw ") + pos + " " + to_string(top + 4 * (++arg_num + 1)) + "($sp)");
+			objectCodes.push_back(string("sw ") + text(pos) + " " + to_string(top + 4 * (++arg_num + 1)) + "($sp)");
 			// release incative variables from the register
 			if (!aiter->second) {
 				releaseVar(aiter->first);
@@ -576,29 +590,29 @@ void ObjectCodeGenerator::generateCodeForQuatenary(int nowBaseBlockIndex, int &a
 		objectCodes.push_back(string("addi $sp $sp ") + to_string(top));
 
 		// jump to the specific function
-		objectCodes.push_back(string("jal ") + nowQuatenary->q.src1);
+		objectCodes.push_back(string("jal ") + text(nowQuatenary->q.src1));
 
 		// restore the stack pointer after the function call
 		objectCodes.push_back(string("lw $sp 0($sp)"));
 	}
 	// return
-	else if (nowQuatenary->q.op == "return") {
+	else if (nowQuatenary->q.op == ATOM_RETURN) {
 		// the return value is a immidiate number, store it in $v0
-		if (isNum(nowQuatenary->q.src1)) {
-			objectCodes.push_back("addi $v0 $zero " + nowQuatenary->q.src1);
+		if (interner->isNum(nowQuatenary->q.src1)) {
+			objectCodes.push_back("addi $v0 $zero " + text(nowQuatenary->q.src1));
 		}
 		// the return value is a variable, find the register where it is stored, and store it in $v0
-		else if (isVar(nowQuatenary->q.src1)) {
-			set<string>::iterator piter = Avalue[nowQuatenary->q.src1].begin();
-			if ((*piter)[0] == '$') {
-				objectCodes.push_back(string("add $v0 $zero ") + *piter);
+		else if (interner->isVar(nowQuatenary->q.src1)) {
+			set<Atom>::iterator piter = Avalue[nowQuatenary->q.src1].begin();
+			if (isRegister(*piter)) {
+				objectCodes.push_back(string("add $v0 $zero ") + text(*piter));
 			}
 			else {
 				objectCodes.push_back(string("lw $v0 ") + to_string(varOffset[*piter]) + "($sp)");
 			}
 		}
 		// return of the main function, jump to the end of the program
-		if (nowFunc == "main") {
+		if (nowFunc == mainFunc) {
 			objectCodes.push_back("j end");
 		}
 		// return of other functions, restore the return address from the stack, and jump to it
@@ -609,18 +623,18 @@ void ObjectCodeGenerator::generateCodeForQuatenary(int nowBaseBlockIndex, int &a
 	}
 	// decleration of paremeters
 	// set the offset in the stack of each parameters
-	else if (nowQuatenary->q.op == "get") {
+	else if (nowQuatenary->q.op == ATOM_GET) {
 		// get the variable offset in the stack
 		varOffset[nowQuatenary->q.des] = top;
 		top += 4;
 		Avalue[nowQuatenary->q.des].insert(nowQuatenary->q.des);
 	}
-	else if (nowQuatenary->q.op == "=") {
-		//Avalue[nowQuatenary->q.des] = set<string>();
-		string src1Pos;
+	else if (nowQuatenary->q.op == ATOM_ASSIGN) {
+		//Avalue[nowQuatenary->q.des] = set<Atom>();
+		Atom src1Pos;
 		// if right value of the expression is return value of a function, it is stored in $v0
-		if (nowQuatenary->q.src1 == "@RETURN_PLACE") {
-			src1Pos = "$v0";
+		if (nowQuatenary->q.src1 == ATOM_RETURN_PLACE) {
+			src1Pos = ATOM_REG_V0;
 		}
 		// else, allocate a register for the right value of the expression
 		else {
@@ -633,21 +647,21 @@ void ObjectCodeGenerator::generateCodeForQuatenary(int nowBaseBlockIndex, int &a
 	// arithmetic expression
 	else {
 		// allocate a register for the source operand 1 and 2, and the destination operand
-		string src1Pos = allocateReg(nowQuatenary->q.src1);
-		string src2Pos = allocateReg(nowQuatenary->q.src2);
-		string desPos = getReg();
-		if (nowQuatenary->q.op == "+") {
-			objectCodes.push_back(string("add ") + desPos + " " + src1Pos + " " + src2Pos);
+		Atom src1Pos = allocateReg(nowQuatenary->q.src1);
+		Atom src2Pos = allocateReg(nowQuatenary->q.src2);
+		Atom desPos = getReg();
+		if (nowQuatenary->q.op == ATOM_ADD) {
+			objectCodes.push_back(string("add ") + text(desPos) + " " + text(src1Pos) + " " + text(src2Pos));
 		}
-		else if (nowQuatenary->q.op == "-") {
-			objectCodes.push_back(string("sub ") + desPos + " " + src1Pos + " " + src2Pos);
+		else if (nowQuatenary->q.op == ATOM_SUB) {
+			objectCodes.push_back(string("sub ") + text(desPos) + " " + text(src1Pos) + " " + text(src2Pos));
 		}
-		else if (nowQuatenary->q.op == "*") {
-			objectCodes.push_back(string("mul ") + desPos + " " + src1Pos + " " + src2Pos);
+		else if (nowQuatenary->q.op == ATOM_MUL) {
+			objectCodes.push_back(string("mul ") + text(desPos) + " " + text(src1Pos) + " " + text(src2Pos));
 		}
-		else if (nowQuatenary->q.op == "/") {
-			objectCodes.push_back(string("div ") + src1Pos + " " + src2Pos);
-			objectCodes.push_back(string("mflo ") + desPos);
+		else if (nowQuatenary->q.op == ATOM_DIV) {
+			objectCodes.push_back(string("div ") + text(src1Pos) + " " + text(src2Pos));
+			objectCodes.push_back(string("mflo ") + text(desPos));
 		}
 		// if the source operand is not active, release it from the register
 		if (!nowQuatenary->info1.active) {
@@ -667,26 +681,26 @@ void ObjectCodeGenerator::generateCodeForBaseBlocks(int nowBaseBlockIndex) {
 	// augment number
 	int arg_num = 0;
 	// parameter list used by function call
-	list<pair<string, bool> > par_list;
+	list<pair<Atom, bool> > par_list;
 
 	// clear the Avalue and Rvalue
 	Avalue.clear();
 	Rvalue.clear();
 	// all the inalive variables of this block
-	set<string>& inl = funcINL[nowFunc][nowBaseBlockIndex];
-	for (set<string>::iterator iter = inl.begin(); iter != inl.end(); iter++) {
+	set<Atom>& inl = funcINL[nowFunc][nowBaseBlockIndex];
+	for (set<Atom>::iterator iter = inl.begin(); iter != inl.end(); iter++) {
 		Avalue[*iter].insert(*iter);
 	}
 
 	// all the registers are free at the beginning
 	freeReg.clear();
-	for (int i = 0; i <= 7; i++) {
-		freeReg.push_back(string("$s") + to_string(i));
+	for (Atom reg = ATOM_REG_S0; reg <= ATOM_REG_S7; reg++) {
+		freeReg.push_back(reg);
 	}
 	// add a label for the basic block
-	objectCodes.push_back(nowIBlock->name + ":");
+	objectCodes.push_back(text(nowIBlock->name) + ":");
 	if (nowBaseBlockIndex == 0) {
-		if (nowFunc == "main") {
+		if (nowFunc == mainFunc) {
 			top = 8;
 		}
 		// if the function is not main, store the return address in the stack, and set the top as 8
@@ -725,7 +739,7 @@ void ObjectCodeGenerator::generateCodeForBaseBlocks(int nowBaseBlockIndex) {
  * @brief generate the object code for a function
  * @param fiter: the iterator of the function
  */
-void ObjectCodeGenerator::generateCodeForFuncBlocks(map<string, vector<BlockWithInfo> >::iterator &fiter) {
+void ObjectCodeGenerator::generateCodeForFuncBlocks(map<Atom, vector<BlockWithInfo> >::iterator &fiter) {
 	varOffset.clear();
 	nowFunc = fiter->first;
 	vector<BlockWithInfo>&iBlocks = fiter->second;
@@ -743,7 +757,7 @@ void ObjectCodeGenerator::generateCode() {
 	objectCodes.push_back("lui $sp,0x1001");
 	objectCodes.push_back("j main");
 	// generate the object code for each function
-	for (map<string, vector<BlockWithInfo> >::iterator fiter = funcIBlocks.begin(); fiter != funcIBlocks.end(); fiter++) {//对每一个函数块
+	for (map<Atom, vector<BlockWithInfo> >::iterator fiter = funcIBlocks.begin(); fiter != funcIBlocks.end(); fiter++) {//对每一个函数块
 		generateCodeForFuncBlocks(fiter);
 	}
 	objectCodes.push_back("end:");
@@ -756,13 +770,13 @@ void ObjectCodeGenerator::generateCode() {
  * @param out: the output stream
  */
 void ObjectCodeGenerator::outputIBlocks(ostream& out) {
-	for (map<string, vector<BlockWithInfo> >::iterator iter = funcIBlocks.begin(); iter != funcIBlocks.end(); iter++) {
-		out << "[" << iter->first << "]" << endl;
+	for (map<Atom, vector<BlockWithInfo> >::iterator iter = funcIBlocks.begin(); iter != funcIBlocks.end(); iter++) {
+		out << "[" << text(iter->first) << "]" << endl;
 		for (vector<BlockWithInfo>::iterator bIter = iter->second.begin(); bIter != iter->second.end(); bIter++) {
-			out << bIter->name << ":" << endl;
+			out << text(bIter->name) << ":" << endl;
 			for (vector<QuaternaryWithInfo>::iterator cIter = bIter->codes.begin(); cIter != bIter->codes.end(); cIter++) {
 				out << "    ";
-				cIter->output(out);
+				cIter->output(out, *interner);
 				out << endl;
 			}
 			out << "    " << "next1 = " << bIter->next1 << endl;
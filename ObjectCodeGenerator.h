@@ -29,14 +29,14 @@ public:
 	// constructor
 	QuaternaryWithInfo(Quaternary q, VarInfomation info1, VarInfomation info2, VarInfomation info3);
 	// output the information
-	void output(ostream& out);
+	void output(ostream& out, const Interner& interner);
 };
 
 /**
  * @brief the basic block with information
  */
 struct BlockWithInfo {
-	string name;
+	Atom name;
 	vector<QuaternaryWithInfo> codes;
 	int next1;
 	int next2;
@@ -50,35 +50,38 @@ struct BlockWithInfo {
  */
 class ObjectCodeGenerator {
 private:
-	map<string,vector<BlockWithInfo> >funcIBlocks;		// the basic blocks of each function
-	map<string, set<string> >Avalue;					// the A value, Avalue[var] = {var, reg1, reg2, ...}, indicating loactions of a variable(temporary or not)
-	map<string, set<string> >Rvalue;					// the R value, Rvalue[Reg] = {var1, var2, ...}, indicating the variables stored in a register
-	map<string, int>varOffset;							// the offset in the stack of each variable
+	Interner* interner;									// the interner of the compilation, all names below are its atoms
+	Atom mainFunc;										// the atom of "main"
+	map<Atom,vector<BlockWithInfo> >funcIBlocks;		// the basic blocks of each function
+	unordered_map<Atom, set<Atom> >Avalue;				// the A value, Avalue[var] = {var, reg1, reg2, ...}, indicating loactions of a variable(temporary or not)
+	map<Atom, set<Atom> >Rvalue;						// the R value, Rvalue[Reg] = {var1, var2, ...}, indicating the variables stored in a register
+	unordered_map<Atom, int>varOffset;					// the offset in the stack of each variable
 	int top;											// the top of the stack
-	list<string>freeReg;								// the free registers		
-	map<string, vector<set<string> > >funcOUTL;			// the out live variables of each function
-	map<string, vector<set<string> > >funcINL;			// the in live variables of each function
-	string nowFunc;										// the function name of the current basic block
+	list<Atom>freeReg;									// the free registers		
+	map<Atom, vector<set<Atom> > >funcOUTL;				// the out live variables of each function
+	map<Atom, vector<set<Atom> > >funcINL;				// the in live variables of each function
+	Atom nowFunc;										// the function name of the current basic block
 	vector<BlockWithInfo>::iterator nowIBlock;			// the current basic block
 	vector<QuaternaryWithInfo>::iterator nowQuatenary;	// the current quaternary
 	vector<string>objectCodes;							// the object codes
 
 	void outputIBlocks(ostream& out);
 	void outputObjectCode(ostream& out);
-	void storeVar(string reg, string var);
-	void storeOutLiveVar(set<string>&outl);
-	void releaseVar(string var);
-	string getReg();
-	string selectReg();
-	string allocateReg(string var);
+	const string& text(Atom atom);
+	void storeVar(Atom reg, Atom var);
+	void storeOutLiveVar(set<Atom>&outl);
+	void releaseVar(Atom var);
+	Atom getReg();
+	Atom selectReg();
+	Atom allocateReg(Atom var);
 
-	void generateCodeForFuncBlocks(map<string, vector<BlockWithInfo> >::iterator &fiter);
+	void generateCodeForFuncBlocks(map<Atom, vector<BlockWithInfo> >::iterator &fiter);
 	void generateCodeForBaseBlocks(int nowBaseBlockIndex);
-	void generateCodeForQuatenary(int nowBaseBlockIndex, int &arg_num, list<pair<string, bool> > &par_list);
+	void generateCodeForQuatenary(int nowBaseBlockIndex, int &arg_num, list<pair<Atom, bool> > &par_list);
 public:
-	ObjectCodeGenerator();
+	ObjectCodeGenerator(Interner* interner);
 	void generateCode();
-	void analyseBlock(map<string, vector<Block> >*funcBlocks);
+	void analyseBlock(map<Atom, vector<Block> >*funcBlocks);
 	void outputIBlocks();
 	void outputIBlocks(const char* fileName);
 	void outputObjectCode();
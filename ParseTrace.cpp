@@ -0,0 +1,78 @@
+#include "ParseTrace.h"
+
+/**
+ * @brief Construct a new empty ParseTrace object
+ */
+ParseTrace::ParseTrace() {
+	this->steps = 0;
+}
+
+/**
+ * @brief forget the events of the last parse, the memory is kept for the next one
+ */
+void ParseTrace::clear() {
+	bytes.clear();
+	steps = 0;
+}
+
+/**
+ * @brief read a number written by putWord
+ * @param offset: the offset of its first byte, moved past its last byte
+ * @return uint32_t
+ */
+uint32_t ParseTrace::getWord(size_t& offset) const {
+	uint32_t word = 0;
+	int shift = 0;
+	while (bytes[offset] & 0x80) {
+		word |= (uint32_t)(bytes[offset++] & 0x7f) << shift;
+		shift += 7;
+	}
+	word |= (uint32_t)bytes[offset++] << shift;
+	return word;
+}
+
+/**
+ * @brief replay the events and print the stacks at each step
+ * @details the lines are the ones the parser printed while parsing: the symbols, then the states, bottom first.
+ * 		The two streams may be the same one, then its lines alternate.
+ * @param symbolOut: the symbol stack of each step
+ * @param stateOut: the state stack of each step
+ * @param symbols: the symbols of the analyse table which made the trace
+ */
+void ParseTrace::output(ostream& symbolOut, ostream& stateOut, const vector<Symbol>& symbols) const {
+	// the state and the symbol of each entry of the stack
+	vector<pair<int, int>> stack;
+	size_t offset = 0;
+	while (offset < bytes.size()) {
+		uint32_t word = getWord(offset);
+		switch (word & 3) {
+			case PUSH:
+			{
+				int symbol = (int)getWord(offset);
+				stack.push_back(pair<int, int>(word >> 2, symbol));
+				break;
+			}
+			case POP:
+			{
+				stack.resize(stack.size() - (word >> 2));
+				break;
+			}
+			case STEP:
+			{
+				if (symbolOut) {
+					for (size_t i = 0; i < stack.size(); i++) {
+						symbolOut << symbols[stack[i].second].content << " ";
+					}
+					symbolOut << "\n";
+				}
+				if (stateOut) {
+					for (size_t i = 0; i < stack.size(); i++) {
+						stateOut << stack[i].first << " ";
+					}
+					stateOut << "\n";
+				}
+				break;
+			}
+		}
+	}
+}
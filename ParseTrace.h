@@ -0,0 +1,58 @@
+#ifndef PARSETRACE_H
+#define PARSETRACE_H
+#include "utils.h"
+#include "Symbol.h"
+
+/**
+ * @brief a log of the pushes and pops of the parse stack, from which the stack of every step can be printed again
+ * @author chtholly
+ * @details printing the whole stack at every token costs the depth of the stack each time, so the parser only
+ * 		records what changed: a push with its state and symbol, a pop with the number of entries, and a step
+ * 		where the stacks would have been printed. Each event is a variable length word, seven bits in a byte:
+ * 		the kind in its two low bits and the state or count above them, a push is followed by a word of its symbol.
+ * 		output() replays the log and prints the stacks as the parser used to, only when they are asked for.
+ */
+class ParseTrace {
+private:
+	enum EventKind { PUSH = 0, POP = 1, STEP = 2 };
+	vector<uint8_t> bytes;				// the events, encoded
+	size_t steps;						// the number of steps recorded
+	// append an unsigned number, seven bits in a byte, the high bit set if more bytes follow
+	void putWord(uint32_t word) {
+		while (word >= 0x80) {
+			bytes.push_back((uint8_t)(word | 0x80));
+			word >>= 7;
+		}
+		bytes.push_back((uint8_t)word);
+	}
+	// read the number at offset, and move the offset past it
+	uint32_t getWord(size_t& offset) const;
+public:
+	ParseTrace();
+	// forget the events of the last parse
+	void clear();
+	// an entry of the state and the symbol is pushed
+	void push(int state, int symbol) {
+		putWord((uint32_t)state << 2 | PUSH);
+		putWord((uint32_t)symbol);
+	}
+	// count entries are popped
+	void pop(int count) {
+		if (count > 0) {
+			putWord((uint32_t)count << 2 | POP);
+		}
+	}
+	// the parser reads the next token with the stacks as they are
+	void step() {
+		bytes.push_back(STEP);
+		steps++;
+	}
+	// print the symbol stack and the state stack of each step, a line for each, a stream which cannot be written is skipped
+	void output(ostream& symbolOut, ostream& stateOut, const vector<Symbol>& symbols) const;
+	// bytes taken by the events
+	size_t size() const { return bytes.size(); }
+	// number of steps recorded
+	size_t stepCount() const { return steps; }
+};
+
+#endif // !PARSETRACE_H
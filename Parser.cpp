@@ -3,11 +3,16 @@
 /**
  * @brief Construct a new Parser:: Parser object
  * @param table : the analyse table of corresponding grammar
+ * @param interner : the interner of the compilation, the atoms of the tokens come from it
  */
-Parser::Parser(AnalyseTable* table) {
+Parser::Parser(AnalyseTable* table, Interner* interner) : code(interner) {
 	this->analyseTable = table;
-	this->lineCount = 1;
+	this->interner = interner;
+	this->input = NULL;
+	this->trace = NULL;
 	this->nowLevel = 0;
+	this->shiftCount = 0;
+	this->reductionCount = 0;
 }
 
 /**
@@ -15,7 +20,7 @@ Parser::Parser(AnalyseTable* table) {
  * @param ID: the name of the function
  * @return Func*: the pointer to the function, if not found, return NULL
  */
-Func* Parser::lookUpFunc(string ID) {
+Func* Parser::lookUpFunc(Atom ID) {
 	for (vector<Func>::iterator iter = funcTable.begin(); iter != funcTable.end(); iter++) {
 		if (iter->name == ID) {
 			return &(*iter);
@@ -29,7 +34,7 @@ Func* Parser::lookUpFunc(string ID) {
  * @param ID: the name of the variable
  * @return Func*: the pointer to the variable, if not found, return NULL
  */
-Var* Parser::lookUpVar(string ID) {
+Var* Parser::lookUpVar(Atom ID) {
 	for (vector<Var>::reverse_iterator iter = varTable.rbegin(); iter != varTable.rend(); iter++) {
 		if (iter->name == ID) {
 			return &(*iter);
@@ -39,10 +44,10 @@ Var* Parser::lookUpVar(string ID) {
 }
 
 
-vector<pair<int, pair<string,DType>>> Parser::getFuncEnter() {
-	vector<pair<int, pair<string,DType>>> ret;
+vector<pair<int, pair<Atom,DType>>> Parser::getFuncEnter() {
+	vector<pair<int, pair<Atom,DType>>> ret;
 	for (vector<Func>::iterator iter = funcTable.begin(); iter != funcTable.end(); iter++) {
-		ret.push_back(pair<int, pair<string,DType>>(iter->enterPoint, pair<string,DType>(iter->name,iter->returnType)));
+		ret.push_back(pair<int, pair<Atom,DType>>(iter->enterPoint, pair<Atom,DType>(iter->name,iter->returnType)));
 	}
 	sort(ret.begin(), ret.end());
 	return ret;
@@ -51,157 +56,167 @@ vector<pair<int, pair<string,DType>>> Parser::getFuncEnter() {
 
 /**
  * @brief check whether the argument list and parameter list match
- * @param argument_list: the argument list
+ * @param argumentCount: the number of arguments
  * @param parameter_list: the parameter list
  * @return true: match
  * @return false: not match
  */
-bool Parser::march(list<string>&argument_list, list<DType>&parameter_list) {
-	return argument_list.size() == parameter_list.size();
+bool Parser::march(int argumentCount, list<DType>&parameter_list) {
+	return argumentCount == (int)parameter_list.size();
 }
 
 /**
- * @brief pop a symbol from the symbol stack
- * @return Symbol*: the pointer to the symbol
+ * @brief the position of the lookahead token for an error message
+ * @details the position is found only now, so the tokens do not carry it while parsing.
+ * 		An error found by a reduction is reported at the token after the reduced symbols.
+ * @return string: " in line L, column C"
  */
-Symbol* Parser::popSymbol() {
-	Symbol* ret = symStack.top();
-	symStack.pop();
-	staStack.pop();
-	return ret;
-}
-
-/**
- * @brief push a symbol to the symbol stack
- * @param sym: the pointer to the symbol
- */
-void Parser::pushSymbol(Symbol* sym) {
-	symStack.push(sym);
-	// if could not find the goto, then there must be some error against the grammar
-	if (analyseTable->LR1_Table.count(GOTO(staStack.top(), *sym)) == 0) {
-		outputError(string("gramma error, unexcepted symbol ") + sym->content);
-		return;
+string Parser::where() {
+	if (input == NULL) {
+		return "";
 	}
-	// get the corresponding behavior, and push the next status to the status stack
-	Behavior bh = analyseTable->LR1_Table[GOTO(staStack.top(), *sym)];
-	staStack.push(bh.nextStat);
+	SourcePosition pos = input->position();
+	return string(" in line ") + to_string(pos.line) + string(", column ") + to_string(pos.column);
 }
 
 /**
- * @brief output the symbol stack to the screen or file
- * @param out 
+ * @brief push the left symbol of a reduction and its value to the parse stack
+ * @param entry: the symbol and its value, the state is the goto of the state on the top
+ * @return true if the goto exists
  */
-void Parser::outputSymbolStack(ostream& out) {
-	stack<Symbol*>temp = symStack;
-	stack<Symbol*>other;
-	while (!temp.empty()) {
-		other.push(temp.top());
-		temp.pop();
+bool Parser::pushEntry(StackEntry entry) {
+	// the goto of the left symbol of a production
+	TableEntry next = analyseTable->goTo(parseStack.back().state, entry.symbol);
+	// if could not find the goto, then there must be some error against the grammar
+	if (!isShiftEntry(next)) {
+		outputError(string("gramma error, unexcepted symbol ") + analyseTable->symbols[entry.symbol].content + where());
+		return false;
 	}
-	while (!other.empty()) {
-		out << other.top()->content << " ";
-		other.pop();
+	entry.state = entryTarget(next);
+	parseStack.push_back(entry);
+	if (trace != NULL) {
+		trace->push(entry.state, entry.symbol);
 	}
-	out << endl;
+	return true;
 }
 
 /**
- * @brief output the status stack to the screen or file
- * @param out 
+ * @brief record the parse stack into a trace
+ * @param trace: the trace, cleared at the start of each parse, NULL not to trace
  */
-void Parser::outputStateStack(ostream& out) {
-	stack<int>temp = staStack;
-	stack<int>other;
-	while (!temp.empty()) {
-		other.push(temp.top());
-		temp.pop();
-	}
-	while (!other.empty()) {
-		out << other.top() << " ";
-		other.pop();
-	}
-	out << endl;
-
+void Parser::setTrace(ParseTrace* trace) {
+	this->trace = trace;
 }
 
 /**
- * @brief analyse the token list and generate the intermediate code
- * @param tokens 
- * @param out 
+ * @brief analyse the tokens and generate the intermediate code
+ * @details the tokens are pulled from the stream one at a time, the next one only after the current one is shifted.
+ * 		A reduction reads the values of its right symbols where they are on the parse stack, then replaces them
+ * 		by the entry of its left symbol. If there is a trace, the changes of the stack are recorded into it.
+ * @param tokens
  */
-void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
-	// if accpted or not
-	bool acc = false;
-	// initialize the symbol stack and status stack
-	symStack.push(new Symbol(true, "#"));
-	staStack.push(0);
-	// the main loop, traverse the token list
-	for (list<Token>::iterator iter = tokens.begin(); iter != tokens.end(); ) {
-		outputSymbolStack(out0);
-		outputStateStack(out1);
-		TokenType LT = iter->getType();
-		string token = iter->getValue();
+void Parser::analyseLR(TokenStream&tokens) {
+	input = &tokens;
+	// initialize the parse stack with the end symbol and the start state
+	parseStack.clear();
+	argumentStack.clear();
+	StackEntry bottom;
+	bottom.state = 0;
+	bottom.symbol = ENDFILE;
+	bottom.kind = ValueKind::None;
+	parseStack.push_back(bottom);
+	if (trace != NULL) {
+		trace->clear();
+		trace->push(bottom.state, bottom.symbol);
+	}
+	// the lookahead token
+	Token lookahead = tokens.next();
+	// the main loop, pull the tokens till the end of file is accepted
+	while (true) {
+		TokenType LT = lookahead.getType();
+		Atom token = lookahead.getValue();
 
 		// if the token is a comment, ignore it
 		if (LT == LCOMMENT || LT == PCOMMENT) {
+			lookahead = tokens.next();
 			continue;
 		}
 
-		// if the token is a nextline, ignore it and add the line count
+		// if the token is a nextline, ignore it
 		if (LT == NEXTLINE) {
-			lineCount++;
+			lookahead = tokens.next();
 			continue;
 		}
 
-		// if the token is a identifier or a number, then create a symbol with the token
-		Symbol* nextSymbol;
-		if (LT == ID) {
-			nextSymbol = new Id(Symbol{ true,"ID" }, token);
-		}
-		else if (LT == NUM) {
-			nextSymbol = new Num(Symbol{ true,"NUM" }, token);
+		// the lexer could not read a token
+		if (LT == ERROR) {
+			outputError(tokens.getErrorText());
+			return;
 		}
-		else {
-			nextSymbol = new Symbol(true, token);
+
+		// the stacks with which the token is read
+		if (trace != NULL) {
+			trace->step();
 		}
 
-		// if could not find the goto, then there must be some error against the grammar
-		if (analyseTable->LR1_Table.count(GOTO(staStack.top(), *nextSymbol)) == 0) {
-			outputError(string("gramma error, unexcepted symbol ") + nextSymbol->content);
+		// get the behavior from the action table, a lazy table builds the state the first time it is reached
+		analyseTable->reach(parseStack.back().state);
+		TableEntry entry = analyseTable->action(parseStack.back().state, LT);
+		// if could not find the action, then there must be some error against the grammar
+		if (entry == 0) {
+			if (LT == ENDFILE) {
+				outputError(string("gramma error: unexpected end of file") + where());
+			}
+			else {
+				outputError(string("gramma error, unexcepted symbol ") + analyseTable->symbols[LT].content + where());
+			}
 			return;
 		}
 
-		// get the behavior with from the goto table
-		Behavior bh = analyseTable->LR1_Table[GOTO(staStack.top(), *nextSymbol)];
-		// if the behavior is shift, then push the symbol and the next status to the stack
-		if (bh.behavior == shift) {
-			symStack.push(nextSymbol);
-			staStack.push(bh.nextStat);
-			iter++;
+		// if the behavior is shift, then push the token and the next status to the stack
+		if (isShiftEntry(entry)) {
+			StackEntry shifted;
+			shifted.state = entryTarget(entry);
+			// the id of a terminal is its token type
+			shifted.symbol = (int16_t)LT;
+			// an identifier or a number keeps its atom
+			if (LT == ID || LT == NUM) {
+				shifted.kind = ValueKind::Named;
+				shifted.named = NamedValue{ token,EMPTY_PATCH_LIST };
+			}
+			else {
+				shifted.kind = ValueKind::None;
+			}
+			parseStack.push_back(shifted);
+			if (trace != NULL) {
+				trace->push(shifted.state, shifted.symbol);
+			}
+			lookahead = tokens.next();
+			shiftCount++;
 		}
 		// if the behavior is reduct
-		else if (bh.behavior == reduct) {
+		else if (isReduceEntry(entry)) {
 			// get the production to be reducted
-			Production reductPro = analyseTable->productions[bh.nextStat];
+			const Production& reductPro = analyseTable->productions[entryTarget(entry)];
+			reductionCount++;
 			// get the number of symbols to be poped
 			int popSymNum = reductPro.right.size();
-			// reduce the symbol stack, and generate the intermediate code
-			switch (bh.nextStat) {
+			// the entries of the right symbols, rhs[0] is the first one
+			StackEntry* rhs = parseStack.data() + parseStack.size() - popSymNum;
+			// the entry of the left symbol, its state is set when it is pushed
+			StackEntry result;
+			result.symbol = (int16_t)reductPro.left.id;
+			result.kind = ValueKind::None;
+			// generate the intermediate code and the value of the left symbol
+			switch (reductPro.id) {
 				/**
 				 * @brief function declare
 				 * @details declare ::= int ID M A function_declare
 				 */
 				case 3:
 				{
-					// pop the symbols
-					FunctionDeclare *function_declare = (FunctionDeclare*)popSymbol();
-					Symbol* A = popSymbol();
-					M* m = (M*)popSymbol();
-					Id* ID = (Id*)popSymbol();
-					Symbol* _int = popSymbol();
 					// add the function to the function table, use m to record the enter point
-					funcTable.push_back(Func{ ID->name,D_INT,function_declare->plist,m->quad });
-					pushSymbol(new Symbol(reductPro.left));
+					funcTable.push_back(Func{ rhs[1].named.name,D_INT,list<DType>(rhs[4].count, D_INT),rhs[2].quad });
 					break;
 				}
 				/**
@@ -210,12 +225,8 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 4:
 				{
-					Symbol* var_declare = popSymbol();
-					Id* ID = (Id*)popSymbol();
-					Symbol* _int = popSymbol();
 					// add the variable to the variable table, and record the level
-					varTable.push_back(Var{ ID->name,D_INT,nowLevel });
-					pushSymbol(new Symbol(reductPro.left));
+					varTable.push_back(Var{ rhs[1].named.name,D_INT,nowLevel });
 					break;
 				}
 				/**
@@ -224,13 +235,7 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 5: //declare ::= void ID M A function_declare
 				{
-					FunctionDeclare* function_declare = (FunctionDeclare*)popSymbol();
-					Symbol* A = popSymbol();
-					M* m = (M*)popSymbol();
-					Id* ID = (Id*)popSymbol();
-					Symbol* _void = popSymbol();
-					funcTable.push_back(Func{ ID->name, D_VOID, function_declare->plist,m->quad });
-					pushSymbol(new Symbol(reductPro.left));
+					funcTable.push_back(Func{ rhs[1].named.name,D_VOID,list<DType>(rhs[4].count, D_INT),rhs[2].quad });
 					break;
 				}
 				/**
@@ -240,7 +245,6 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				case 6: //A ::=
 				{
 					nowLevel++;
-					pushSymbol(new Symbol(reductPro.left));
 					break;
 				}
 				/**
@@ -249,13 +253,8 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 8:
 				{
-					SentenceBlock* sentence_block = (SentenceBlock*)popSymbol();
-					Symbol* rparen = popSymbol();
-					Parameter* paramter = (Parameter*)popSymbol();
-					Symbol* lparen = popSymbol();
-					FunctionDeclare* function_declare = new FunctionDeclare(reductPro.left);
-					function_declare->plist.assign(paramter->plist.begin(), paramter->plist.end());
-					pushSymbol(function_declare);
+					result.kind = ValueKind::Count;
+					result.count = rhs[1].count;
 					break;
 				}
 				/**
@@ -264,21 +263,18 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 9: //parameter :: = parameter_list
 				{
-					ParameterList* parameter_list = (ParameterList*)popSymbol();
-					Parameter *parameter = new Parameter(reductPro.left);
-					parameter->plist.assign(parameter_list->plist.begin(), parameter_list->plist.end());
-					pushSymbol(parameter);
+					result.kind = ValueKind::Count;
+					result.count = rhs[0].count;
 					break;
 				}
 				/**
-				 * @brief void parameter 
+				 * @brief void parameter
 				 * @details parameter ::= void
 				 */
 				case 10:
 				{
-					Symbol* _void = popSymbol();
-					Parameter* parameter = new Parameter(reductPro.left);
-					pushSymbol(parameter);
+					result.kind = ValueKind::Count;
+					result.count = 0;
 					break;
 				}
 				/**
@@ -287,25 +283,19 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 11:
 				{
-					Symbol* param = popSymbol();
-					ParameterList* parameter_list = new ParameterList(reductPro.left);
-					parameter_list->plist.push_back(D_INT);
-					pushSymbol(parameter_list);
+					result.kind = ValueKind::Count;
+					result.count = 1;
 					break;
 				}
 				/**
 				 * @brief parameter list
-				 * @details parameter_list ::= param , parameter_list
+				 * @details parameter_list ::= parameter_list , param
 				 */
 				case 12:
 				{
-					ParameterList* parameter_list2 = (ParameterList*)popSymbol();
-					Symbol* comma = popSymbol();
-					Symbol* param = popSymbol();
-					ParameterList *parameter_list1 = new ParameterList(reductPro.left);
-					parameter_list2->plist.push_front(D_INT);
-					parameter_list1->plist.assign(parameter_list2->plist.begin(), parameter_list2->plist.end());
-					pushSymbol(parameter_list1);
+					// the list is left recursive, the parameter is counted with the list it reduces from
+					result = rhs[0];
+					result.count++;
 					break;
 				}
 				/**
@@ -314,25 +304,18 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 13:
 				{
-					Id* ID = (Id*)popSymbol();
-					Symbol* _int = popSymbol();
-					varTable.push_back(Var{ ID->name,D_INT,nowLevel });
-					code._emit("get", "_", "_", ID->name);
-					pushSymbol(new Symbol(reductPro.left));
+					varTable.push_back(Var{ rhs[1].named.name,D_INT,nowLevel });
+					code._emit(ATOM_GET, ATOM_BLANK, ATOM_BLANK, rhs[1].named.name);
 					break;
 				}
 				/**
 				 * @brief sentence block end, pop the variable not in the current level
 				 * @details sentence_block ::= { inner_declare sentence_list }
 				 */
-				case 14: 
+				case 14:
 				{
-					Symbol* rbrace = popSymbol();
-					SentenceList* sentence_list = (SentenceList*)popSymbol();
-					Symbol* inner_declare = popSymbol();
-					Symbol* lbrace = popSymbol();
-					SentenceBlock* sentence_block = new SentenceBlock(reductPro.left);
-					sentence_block->nextList = sentence_list->nextList;
+					result.kind = ValueKind::Jumps;
+					result.jumps = rhs[2].jumps;
 					// now level decrease
 					nowLevel--;
 					// pop the variable not in the current level, local variable
@@ -347,7 +330,6 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 					for (int i = 0; i < popNum; i++) {
 						varTable.pop_back();
 					}
-					pushSymbol(sentence_block);
 					break;
 				}
 				/**
@@ -356,26 +338,19 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 17:
 				{
-					Id* ID = (Id*)popSymbol();
-					Symbol* _int = popSymbol();
-					pushSymbol(new Symbol(reductPro.left));
-					varTable.push_back(Var{ ID->name,D_INT,nowLevel });
+					varTable.push_back(Var{ rhs[1].named.name,D_INT,nowLevel });
 					break;
 				}
 				/**
 				 * @brief sentence list
-				 * @details sentence_list ::= sentence M sentence_list
+				 * @details sentence_list ::= sentence_list M sentence
 				 */
 				case 18:
 				{
-					SentenceList* sentence_list2 = (SentenceList*)popSymbol();
-					M* m = (M*)popSymbol();
-					Sentence* sentence = (Sentence*)popSymbol();
-					SentenceList* sentence_list1 = new SentenceList(reductPro.left);
-					sentence_list1->nextList = sentence_list2->nextList;
-					// back patch the next list of the sentence
-					code.back_patch(sentence->nextList, m->quad);
-					pushSymbol(sentence_list1);
+					// the sentences before go on to this one, the list goes on where this sentence does
+					code.back_patch(rhs[0].jumps, rhs[1].quad);
+					result.kind = ValueKind::Jumps;
+					result.jumps = rhs[2].jumps;
 					break;
 				}
 				/**
@@ -383,35 +358,19 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 * @details sentence_list ::= sentence
 				 */
 				case 19:
-				{
-					Sentence* sentence = (Sentence*)popSymbol();
-					SentenceList* sentence_list = new SentenceList(reductPro.left);
-					sentence_list->nextList = sentence->nextList;
-					pushSymbol(sentence_list);
-					break;
-				}
 				/**
 				 * @brief sentence
 				 * @details sentence ::= if_sentence
 				 */
 				case 20:
-				{
-					IfSentence* if_sentence = (IfSentence*)popSymbol();
-					Sentence* sentence = new Sentence(reductPro.left);
-					sentence->nextList = if_sentence->nextList;
-					pushSymbol(sentence);
-					break;
-				}
 				/**
 				 * @brief sentence
 				 * @details sentence ::= while_sentence
 				 */
-				case 21: 
+				case 21:
 				{
-					WhileSentence* while_sentence = (WhileSentence*)popSymbol();
-					Sentence* sentence = new Sentence(reductPro.left);
-					sentence->nextList = while_sentence->nextList;
-					pushSymbol(sentence);
+					result.kind = ValueKind::Jumps;
+					result.jumps = rhs[0].jumps;
 					break;
 				}
 				/**
@@ -419,21 +378,14 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 * @details sentence ::= return_sentence
 				 */
 				case 22:
-				{
-					Symbol* return_sentence = popSymbol();
-					Sentence* sentence = new Sentence(reductPro.left);
-					pushSymbol(sentence);
-					break;
-				}
 				/**
 				 * @brief sentence
 				 * @details sentence ::= assign_sentence
 				 */
 				case 23:
 				{
-					Symbol* assign_sentence = popSymbol();
-					Sentence* sentence = new Sentence(reductPro.left);
-					pushSymbol(sentence);
+					result.kind = ValueKind::Jumps;
+					result.jumps = EMPTY_PATCH_LIST;
 					break;
 				}
 				/**
@@ -442,19 +394,13 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 24:
 				{
-					Symbol* comma = popSymbol();
-					Expression* expression = (Expression*)popSymbol();
-					Symbol* assign = popSymbol();
-					Id* ID = (Id*)popSymbol();
 					// check whether the variable is declared
-					if (lookUpVar(ID->name) == NULL) {
-						outputError(string("variable ") + ID->name + string(" not declared"));
+					if (lookUpVar(rhs[0].named.name) == NULL) {
+						outputError(string("variable ") + interner->text(rhs[0].named.name) + string(" not declared") + where());
 						return;
 					}
-					Symbol* assign_sentence = new Symbol(reductPro.left);
 					// emit the intermediate code
-					code._emit("=", expression->name, "_", ID->name);
-					pushSymbol(assign_sentence);
+					code._emit(ATOM_ASSIGN, rhs[2].named.name, ATOM_BLANK, rhs[0].named.name);
 					break;
 				}
 				/**
@@ -463,10 +409,7 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 25:
 				{
-					Symbol* comma = popSymbol();
-					Symbol* _return = popSymbol();
-					code._emit("return", "_", "_", "_");
-					pushSymbol(new Symbol(reductPro.left));
+					code._emit(ATOM_RETURN, ATOM_BLANK, ATOM_BLANK, ATOM_BLANK);
 					break;
 				}
 				/**
@@ -475,11 +418,7 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 26:
 				{
-					Symbol* comma = popSymbol();
-					Expression* expression = (Expression*)popSymbol();
-					Symbol* _return = popSymbol();
-					code._emit("return", expression->name, "_", "_");
-					pushSymbol(new Symbol(reductPro.left));
+					code._emit(ATOM_RETURN, rhs[1].named.name, ATOM_BLANK, ATOM_BLANK);
 					break;
 				}
 				/**
@@ -488,19 +427,12 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 27:
 				{
-					SentenceBlock* sentence_block = (SentenceBlock*)popSymbol();
-					Symbol* A = popSymbol();
-					Symbol* rparen = popSymbol();
-					Expression* expression = (Expression*)popSymbol();
-					Symbol* lparen = popSymbol();
-					M* m = (M*)popSymbol();
-					Symbol* _while = popSymbol();
-					WhileSentence* while_sentence = new WhileSentence(reductPro.left);
-					code.back_patch(sentence_block->nextList, m->quad);
-					while_sentence->nextList = expression->falseList;
+					int quad = rhs[1].quad;
+					code.back_patch(rhs[6].jumps, quad);
+					result.kind = ValueKind::Jumps;
+					result.jumps = rhs[3].named.falseList;
 					// generate the intermediate code to jump to the while sentence
-					code._emit("j", "_", "_", to_string(m->quad));
-					pushSymbol(while_sentence);
+					code._emit(ATOM_J, ATOM_BLANK, ATOM_BLANK, interner->intern(to_string(quad)));
 					break;
 				}
 				/**
@@ -509,16 +441,8 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 28:
 				{
-					SentenceBlock* sentence_block = (SentenceBlock*)popSymbol();
-					Symbol* A = popSymbol();
-					Symbol* rparen = popSymbol();
-					Expression* expression = (Expression*)popSymbol();
-					Symbol* lparen = popSymbol();
-					Symbol* _if = popSymbol();
-					IfSentence* if_sentence = new IfSentence(reductPro.left);
-					expression->falseList.splice(expression->falseList.begin(), sentence_block->nextList);
-					if_sentence->nextList = expression->falseList;
-					pushSymbol(if_sentence);
+					result.kind = ValueKind::Jumps;
+					result.jumps = code.mergeList(rhs[5].jumps, rhs[2].named.falseList);
 					break;
 				}
 				/**
@@ -527,386 +451,219 @@ void Parser::analyseLR(list<Token>&tokens, ostream& out0, ostream& out1) {
 				 */
 				case 29:
 				{
-					SentenceBlock* sentence_block2 = (SentenceBlock*)popSymbol();
-					Symbol* A2 = popSymbol();
-					M* m = (M*)popSymbol();
-					Symbol* _else = popSymbol();
-					N* n = (N*)popSymbol();
-					SentenceBlock* sentence_block1 = (SentenceBlock*)popSymbol();
-					Symbol* A1 = popSymbol();
-					Symbol* rparen = popSymbol();
-					Expression* expression = (Expression*)popSymbol();
-					Symbol* lparen = popSymbol();
-					Symbol* _if = popSymbol();
-					IfSentence* if_sentence = new IfSentence(reductPro.left);
-					code.back_patch(expression->falseList, m->quad);
-					if_sentence->nextList = merge(sentence_block1->nextList, sentence_block2->nextList);
-					if_sentence->nextList = merge(if_sentence->nextList, n->nextList);
-					pushSymbol(if_sentence);
+					code.back_patch(rhs[2].named.falseList, rhs[8].quad);
+					result.kind = ValueKind::Jumps;
+					result.jumps = code.mergeList(code.mergeList(rhs[5].jumps, rhs[10].jumps), rhs[6].jumps);
 					break;
 				}
 				/**
 				 * @brief N ::=, control the transfer of the if sentence
-				 * @details N ::= 
+				 * @details N ::=
 				 */
 				case 30:
 				{
-					N* n = new N(reductPro.left);
-					n->nextList.push_back(code.nextQuad());
-					code._emit("j", "_", "_", "-1");
-					pushSymbol(n);
+					result.kind = ValueKind::Jumps;
+					result.jumps = code.makeList(code.nextQuad());
+					code._emit(ATOM_J, ATOM_BLANK, ATOM_BLANK, interner->intern("-1"));
 					break;
 				}
 				/**
 				 * @brief M ::=, control the transfer of the while sentence
-				 * @details M ::= 
+				 * @details M ::=
 				 */
-				case 31: 
+				case 31:
 				{
-					M* m = new M(reductPro.left);
-					m->quad = code.nextQuad();
-					pushSymbol(m);
+					result.kind = ValueKind::Quad;
+					result.quad = code.nextQuad();
 					break;
 				}
 				/**
 				 * @brief expression
-				 * @details expression ::= add_expression
+				 * @details expression ::= arith_expression
 				 */
-				case 32: 
+				case 32:
 				{
-					AddExpression* add_expression = (AddExpression*)popSymbol();
-					Expression* expression = new Expression(reductPro.left);
-					expression->name = add_expression->name;
-					pushSymbol(expression);
+					result = rhs[0];
 					break;
 				}
 				/**
 				 * @brief expression
-				 * @details expression ::= add_expression1 > add_expression2
-				 */
-				case 33: 
-				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol* gt = popSymbol();
-					AddExpression* add_expression1 = (AddExpression*)popSymbol();
-					Expression* expression = new Expression(reductPro.left);
-					expression->falseList.push_back(code.nextQuad());
-					code._emit("j<=", add_expression1->name, add_expression2->name, "-1");
-					pushSymbol(expression);
-					break;
-				}
-				/**
-				 * @brief expression
-				 * @details expression ::= add_expression1 < add_expression2
+				 * @details expression ::= arith_expression1 relop arith_expression2, relop is > < == >= <= !=,
+				 * 		the jump is taken when the condition is false
 				 */
+				case 33:
 				case 34:
-				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol* lt = popSymbol();
-					AddExpression* add_expression1 = (AddExpression*)popSymbol();
-					Expression* expression = new Expression(reductPro.left);
-					expression->falseList.push_back(code.nextQuad());
-					code._emit("j>=", add_expression1->name, add_expression2->name, "-1");
-					pushSymbol(expression);
-					break;
-				}
-				/**
-				 * @brief expression
-				 * @details expression ::= add_expression1 == add_expression2
-				 */
-				case 35: 
-				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol *eq = popSymbol();
-					AddExpression *add_expression1 = (AddExpression*)popSymbol();
-					Expression *expression = new Expression(reductPro.left);
-					expression->falseList.push_back(code.nextQuad());
-					code._emit("j!=", add_expression1->name, add_expression2->name, "-1");
-					pushSymbol(expression);
-					break;
-				}
-				/**
-				 * @brief expression
-				 * @details expression ::= add_expression1 >= add_expression2
-				 */
-				case 36: 
-				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol* get = popSymbol();
-					AddExpression* add_expression1 = (AddExpression*)popSymbol();
-					Expression* expression = new Expression(reductPro.left);
-					expression->falseList.push_back(code.nextQuad());
-					code._emit("j<", add_expression1->name, add_expression2->name, "-1");
-					pushSymbol(expression);
-					break;
-				}
-				/**
-				 * @brief expression
-				 * @details expression ::= add_expression1 <= add_expression2
-				 */
+				case 35:
+				case 36:
 				case 37:
-				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol* let = popSymbol();
-					AddExpression* add_expression1 = (AddExpression*)popSymbol();
-					Expression* expression = new Expression(reductPro.left);
-					expression->falseList.push_back(code.nextQuad());
-					code._emit("j>", add_expression1->name, add_expression2->name, "-1");
-					pushSymbol(expression);
-					break;
-				}
-				/**
-				 * @brief expression
-				 * @details expression ::= add_expression1 != add_expression2
-				 */
 				case 38:
 				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol* neq = popSymbol();
-					AddExpression* add_expression1 = (AddExpression*)popSymbol();
-					Expression* expression = new Expression(reductPro.left);
-					expression->falseList.push_back(code.nextQuad());
-					code._emit("j==", add_expression1->name, add_expression2->name, "-1");
-					pushSymbol(expression);
+					static const Atom falseJumps[] = { ATOM_JLE, ATOM_JGE, ATOM_JNE, ATOM_JLT, ATOM_JGT, ATOM_JEQ };
+					// a condition has no value of its own
+					result.kind = ValueKind::Named;
+					result.named = NamedValue{ ATOM_EMPTY,code.makeList(code.nextQuad()) };
+					code._emit(falseJumps[reductPro.id - 33], rhs[0].named.name, rhs[2].named.name, interner->intern("-1"));
 					break;
 				}
 				/**
-				 * @brief add expression
-				 * @details add_expression ::= item
+				 * @brief arithmetic expression
+				 * @details arith_expression ::= arith_expression1 op arith_expression2, op is + - * /
 				 */
 				case 39:
-				{
-					Nomial* item = (Nomial*)popSymbol();
-					AddExpression* add_expression = new AddExpression(reductPro.left);
-					add_expression->name = item->name;
-					pushSymbol(add_expression);
-					break;
-				}
-				/**
-				 * @brief add expression
-				 * @details add_expression1 ::= item + add_expression2
-				 */
 				case 40:
-				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol* add = popSymbol();
-					Nomial* item = (Nomial*)popSymbol();
-					AddExpression* add_expression1 = new AddExpression(reductPro.left);
-					add_expression1->name = code.newTemp();
-					code._emit("+", item->name, add_expression2->name, add_expression1->name);
-					pushSymbol(add_expression1);
-					break;
-				}
-				/**
-				 * @brief add expression
-				 * @details add_expression1 ::= item - add_expression2
-				 */
 				case 41:
+				case 42:
 				{
-					AddExpression* add_expression2 = (AddExpression*)popSymbol();
-					Symbol* sub = popSymbol();
-					Nomial* item = (Nomial*)popSymbol();
-					AddExpression* add_expression1 = new AddExpression(reductPro.left);
-					add_expression1->name = code.newTemp();
-					code._emit("-", item->name, add_expression2->name, add_expression1->name);
-					pushSymbol(add_expression1);
+					static const Atom operators[] = { ATOM_ADD, ATOM_SUB, ATOM_MUL, ATOM_DIV };
+					// the operators are left associative by their precedence
+					Atom temp = code.newTemp();
+					code._emit(operators[reductPro.id - 39], rhs[0].named.name, rhs[2].named.name, temp);
+					result.kind = ValueKind::Named;
+					result.named = NamedValue{ temp,EMPTY_PATCH_LIST };
 					break;
 				}
 				/**
-				 * @brief item
-				 * @details item ::= factor
-				 */
-				case 42: 
-				{
-					Factor* factor = (Factor*)popSymbol();
-					Nomial* item = new Nomial(reductPro.left);
-					item->name = factor->name;
-					pushSymbol(item);
-					break;
-				}
-				/**
-				 * @brief item
-				 * @details item1 ::= factor * item2
+				 * @brief arithmetic expression, a number
+				 * @details arith_expression ::= NUM
 				 */
 				case 43:
 				{
-					Nomial* item2 = (Nomial*)popSymbol();
-					Symbol* mul = popSymbol();
-					Factor* factor = (Factor*)popSymbol();
-					Nomial* item1 = new Nomial(reductPro.left);
-					item1->name = code.newTemp();
-					code._emit("*", factor->name, item2->name, item1->name);
-					pushSymbol(item1);
+					result = rhs[0];
 					break;
 				}
 				/**
-				 * @brief item
-				 * @details item1 ::= factor / item2
+				 * @brief arithmetic expression in parentheses
+				 * @details arith_expression ::= ( expression )
 				 */
 				case 44:
 				{
-					Nomial* item2 = (Nomial*)popSymbol();
-					Symbol* div = popSymbol();
-					Factor* factor = (Factor*)popSymbol();
-					Nomial* item1 = new Nomial(reductPro.left);
-					item1->name = code.newTemp();
-					code._emit("/", factor->name, item2->name, item1->name);
-					pushSymbol(item1);
+					result.kind = ValueKind::Named;
+					result.named = NamedValue{ rhs[1].named.name,EMPTY_PATCH_LIST };
 					break;
 				}
 				/**
-				 * @brief factor
-				 * @details factor ::= NUM
+				 * @brief arithmetic expression, call the function
+				 * @details arith_expression ::= ID ( argument_list )
 				 */
 				case 45:
 				{
-					Num* num = (Num*)popSymbol();
-					Factor* factor = new Factor(reductPro.left);
-					factor->name = num->number;
-					pushSymbol(factor);
-					break;
-				}
-				/**
-				 * @brief factor
-				 * @details factor ::= ( expression )
-				 */
-				case 46: 
-				{
-					Symbol* rparen = popSymbol();
-					Expression* expression = (Expression*)popSymbol();
-					Symbol* lparen = popSymbol();
-					Factor* factor = new Factor(reductPro.left);
-					factor->name = expression->name;
-					pushSymbol(factor);
-					break;
-				}
-				/**
-				 * @brief factor, call the function
-				 * @details factor ::= ID ( argument_list )
-				 */
-				case 47: 
-				{
-					Symbol* rparen = popSymbol();
-					ArgumentList* argument_list = (ArgumentList*)popSymbol();
-					Symbol* lparen = popSymbol();
-					Id* ID = (Id*)popSymbol();
-					Factor* factor = new Factor(reductPro.left);
-					Func* f = lookUpFunc(ID->name);
+					Atom name = rhs[0].named.name;
+					ArgumentRange arguments = rhs[2].arguments;
+					Func* f = lookUpFunc(name);
 					// check if the function is declared and the input parameter is correct
 					if (!f) {
-						outputError(string("gramma error, undeclared function ")+ ID->name);
+						outputError(string("gramma error, undeclared function ")+ interner->text(name) + where());
 						return;
 					}
-					else if (!march(argument_list->alist, f->paramTypes)) {
-						outputError(string("gramma error, inputed parameter do not match with decleration of function ") + ID->name);
+					else if (!march(arguments.count, f->paramTypes)) {
+						outputError(string("gramma error, inputed parameter do not match with decleration of function ") + interner->text(name) + where());
 						return;
 					}
-					else {
-						// generate the intermediate code, indicate the parameters
-						for (list<string>::iterator iter = argument_list->alist.begin(); iter != argument_list->alist.end(); iter++) {
-							code._emit("par", *iter, "_", "_");
-						}
-						factor->name = code.newTemp();
-						// function call
-						code._emit("call", ID->name,"_", "_");
-						// get the return value of function
-						code._emit("=", "@RETURN_PLACE", "_", factor->name);
-						
-						pushSymbol(factor);
+					// generate the intermediate code, indicate the parameters
+					for (int i = arguments.start; i < arguments.start + arguments.count; i++) {
+						code._emit(ATOM_PAR, argumentStack[i], ATOM_BLANK, ATOM_BLANK);
 					}
+					// the arguments of a call are the last ones on the stack
+					argumentStack.resize(arguments.start);
+					result.kind = ValueKind::Named;
+					result.named = NamedValue{ code.newTemp(),EMPTY_PATCH_LIST };
+					// function call
+					code._emit(ATOM_CALL, name, ATOM_BLANK, ATOM_BLANK);
+					// get the return value of function
+					code._emit(ATOM_ASSIGN, ATOM_RETURN_PLACE, ATOM_BLANK, result.named.name);
 					break;
 				}
 				/**
-				 * @brief factor, get the value of the variable
-				 * @details factor ::= ID
+				 * @brief arithmetic expression, get the value of the variable
+				 * @details arith_expression ::= ID
 				 */
-				case 48:
+				case 46:
 				{
-					Id* ID = (Id*)popSymbol();
-					if (lookUpVar(ID->name) == NULL) {
-						outputError(string("gramma error, undeclared variable ")+ ID->name);
+					if (lookUpVar(rhs[0].named.name) == NULL) {
+						outputError(string("gramma error, undeclared variable ")+ interner->text(rhs[0].named.name) + where());
 						return;
 					}
-					Factor* factor = new Factor(reductPro.left);
-					factor->name = ID->name;
-					pushSymbol(factor);
+					result = rhs[0];
 					break;
 				}
 				/**
 				 * @brief argument list
-				 * @details argument_list ::= 
+				 * @details argument_list ::=
 				 */
-				case 49: //argument_list ::= 
+				case 47: //argument_list ::=
 				{
-					ArgumentList* argument_list = new ArgumentList(reductPro.left);
-					pushSymbol(argument_list);
+					result.kind = ValueKind::Arguments;
+					result.arguments = ArgumentRange{ (int)argumentStack.size(),0 };
 					break;
 				}
 				/**
 				 * @brief argument list
-				 * @details argument_list ::= expression
+				 * @details argument_list ::= arguments
 				 */
-				case 50:
+				case 48:
+				{
+					result = rhs[0];
+					break;
+				}
+				/**
+				 * @brief arguments
+				 * @details arguments ::= expression
+				 */
+				case 49:
 				{
-					Expression* expression = (Expression*)popSymbol();
-					ArgumentList* argument_list = new ArgumentList(reductPro.left);
-					argument_list->alist.push_back(expression->name);
-					pushSymbol(argument_list);
+					result.kind = ValueKind::Arguments;
+					result.arguments = ArgumentRange{ (int)argumentStack.size(),1 };
+					argumentStack.push_back(rhs[0].named.name);
 					break;
 				}
 				/**
-				 * @brief argument list expand
-				 * @details argument_list ::= expression , argument_list
+				 * @brief arguments expand
+				 * @details arguments ::= arguments , expression
 				 */
-				case 51:
+				case 50:
 				{
-					ArgumentList* argument_list2 = (ArgumentList*)popSymbol();
-					Symbol* comma = popSymbol();
-					Expression* expression = (Expression*)popSymbol();
-					ArgumentList* argument_list1 = new ArgumentList(reductPro.left);
-					argument_list2->alist.push_front(expression->name);
-					argument_list1->alist.assign(argument_list2->alist.begin(),argument_list2->alist.end());
-					pushSymbol(argument_list1);
+					// the arguments of the inner calls are gone, this one follows the list
+					argumentStack.push_back(rhs[2].named.name);
+					result = rhs[0];
+					result.arguments.count++;
 					break;
 				}
 				/**
-				 * @brief other production, just pop the symbol stack and push the left symbol
+				 * @brief other production, the left symbol has no value
 				 */
 				default:
 				{
-					for (int i = 0; i < popSymNum; i++) {
-						popSymbol();
-					}
-					pushSymbol(new Symbol(reductPro.left));
 					break;
 				}
 			}
+			// replace the right symbols by the left one
+			parseStack.resize(parseStack.size() - popSymNum);
+			if (trace != NULL) {
+				trace->pop(popSymNum);
+			}
+			result.symbol = (int16_t)reductPro.left.id;
+			if (!pushEntry(result)) {
+				return;
+			}
 		}
 		/**
 		 * @brief accept the input
 		 * @details P ::= N declare_list
 		 */
-		else if (bh.behavior == accept) {
-			acc = true;
-			Func*f = lookUpFunc("main");
-			popSymbol();
-			N* n = (N*)popSymbol();
-			code.back_patch(n->nextList, f->enterPoint);
+		else if (isAcceptEntry(entry)) {
+			Func*f = lookUpFunc(interner->intern("main"));
+			code.back_patch(parseStack[parseStack.size() - 2].jumps, f->enterPoint);
 			break;
 		}
 	}
-	if (!acc) {
-		outputError("gramma error: unexpected end of file");
-		return;
-	}
 }
 
 /**
- * @brief analyse the token list and generate the intermediate code
+ * @brief analyse the tokens and generate the intermediate code
  * @param tokens 
- * @param fileName: the name of the file to output the intermediate code
+ * @param fileName: the name of the file to output the symbol stack and the state stack, their lines alternate
  */
-void Parser::analyse(list<Token>&tokens, const char* fileName)
+void Parser::analyse(TokenStream&tokens, const char* fileName)
 {
 	ofstream fout0;
 	fout0.open(fileName);
@@ -914,16 +671,17 @@ void Parser::analyse(list<Token>&tokens, const char* fileName)
 		outputError("fail to open file " + string(fileName));
 		return;
 	}
-	analyseLR(tokens, fout0 , fout0);
+	analyseTraced(tokens, fout0, fout0);
 	fout0.close();
 }
 
 /**
- * @brief analyse the token list and generate the intermediate code
+ * @brief analyse the tokens and generate the intermediate code
  * @param tokens 
- * @param fileName: the name of the file to output the intermediate code
+ * @param f0: the name of the file to output the symbol stack
+ * @param f1: the name of the file to output the state stack
  */
-void Parser::analyse(list<Token>&tokens,const char* f0, const char* f1) {
+void Parser::analyse(TokenStream&tokens,const char* f0, const char* f1) {
 	ofstream fout0, fout1;
 	fout0.open(f0);
 	fout1.open(f1);
@@ -935,12 +693,30 @@ void Parser::analyse(list<Token>&tokens,const char* f0, const char* f1) {
 		outputError("fail to open file " + string(f1));
 		return;
 	}
-	analyseLR(tokens, fout0, fout1);
+	analyseTraced(tokens, fout0, fout1);
 
 	fout0.close();
 	fout1.close();
 }
 
+/**
+ * @brief analyse the tokens with a trace, then print the stacks of the trace
+ * @details the trace set by setTrace is used if there is one, otherwise one only for this parse
+ * @param tokens
+ * @param out0: the symbol stack of each step
+ * @param out1: the state stack of each step
+ */
+void Parser::analyseTraced(TokenStream&tokens, ostream& out0, ostream& out1) {
+	ParseTrace ownTrace;
+	ParseTrace* previous = trace;
+	if (trace == NULL) {
+		trace = &ownTrace;
+	}
+	analyseLR(tokens);
+	trace->output(out0, out1, analyseTable->symbols);
+	trace = previous;
+}
+
 /**
  * @brief get the intermediate code
  * @return IntermediateCode* 
@@ -1,8 +1,10 @@
 #include "utils.h"
 #include "Symbol.h"
 #include "Token.h"
+#include "TokenStream.h"
 #include "table.h"
 #include "IntermediateCode.h"
+#include "ParseTrace.h"
 #include "table.h"
 #ifndef PARSER_H
 #define PARSER_H
@@ -11,7 +13,7 @@
  * @brief the type of variable
  */
 struct Var {
-	string name;				// variable name
+	Atom name;					// variable name
 	DType type;					// variable type
 	int level;					// variable level	
 };
@@ -20,42 +22,91 @@ struct Var {
  * @brief the type of function
  */
 struct Func {
-	string name;				// function name
+	Atom name;					// function name
 	DType returnType;			// function return type
 	list<DType> paramTypes;		// function parameter type
 	int enterPoint;				// function enter point
 };
 
+/**
+ * @brief what the semantic value of an entry of the parse stack holds, it follows from the symbol
+ */
+enum class ValueKind : uint8_t {
+	None,						// the symbols without a value, like the terminals except ID and NUM
+	Named,						// ID, NUM, arith_expression and expression: an atom, and the jumps of a false condition
+	Jumps,						// N, the sentences and the sentence blocks: the jumps to where they go on
+	Quad,						// M: the index of the next quaternary
+	Count,						// parameter, parameter_list and function_declare: the number of int parameters
+	Arguments					// argument_list and arguments: their atoms on the argument stack
+};
+
+// an atom, and the jumps taken if it is a condition which is false
+struct NamedValue {
+	Atom name;
+	PatchList falseList;
+};
+
+// the atoms of an argument list, argumentStack[start .. start + count)
+struct ArgumentRange {
+	int start;
+	int count;
+};
+
+/**
+ * @brief an entry of the parse stack: a state, the symbol which led to it and the semantic value of the symbol
+ * @details the entries are kept in a vector, so the right symbols of a production are side by side at its top
+ * 		when it is reduced, and a value is copied in place instead of allocated
+ */
+struct StackEntry {
+	int state;					// the state pushed with the symbol
+	int16_t symbol;				// the id of the symbol in the analyse table
+	ValueKind kind;				// the member of the union which holds the value
+	union {
+		NamedValue named;
+		PatchList jumps;
+		int quad;
+		int count;
+		ArgumentRange arguments;
+	};
+};
+
 /**
  * @brief the parser class, which is used to parse the source code and run semantic analysis
  * @author chtholly
  */
 class Parser {
 private:
-	int lineCount;						// current line number
+	TokenStream* input;					// the tokens being parsed, they give the positions of the errors
+	ParseTrace* trace;					// the trace of the parse stack, NULL if the parse is not traced
 	int nowLevel;						// level of current statement block, used to realize function scope
 	
 	AnalyseTable* analyseTable;			// analyse table
-	stack<Symbol*> symStack;			// symbol stack
-	stack<int> staStack;				// status stack
+	Interner* interner;					// interner of the compilation
+	vector<StackEntry> parseStack;		// the states, symbols and semantic values
+	vector<Atom> argumentStack;			// the arguments of the calls being parsed, the inner calls last
 	vector<Var> varTable;				// variable table
 	vector<Func> funcTable;				// function table
 	IntermediateCode code;				// intermediate code
+	size_t shiftCount;					// tokens shifted by analyseLR
+	size_t reductionCount;				// reductions done by analyseLR
 
-	Func* lookUpFunc(string ID);
-	Var* lookUpVar(string ID);
-	bool march(list<string>&argument_list,list<DType>&parameter_list);
-	Symbol* popSymbol();
-	void pushSymbol(Symbol* sym);
-	void outputStateStack(ostream& out);
-	void outputSymbolStack(ostream& out);
+	Func* lookUpFunc(Atom ID);
+	Var* lookUpVar(Atom ID);
+	bool march(int argumentCount,list<DType>&parameter_list);
+	bool pushEntry(StackEntry entry);
+	string where();
+	void analyseTraced(TokenStream&tokens, ostream& out0, ostream& out1);
 public:
-	Parser(AnalyseTable* table);
-	void analyseLR(list<Token>&tokens, ostream& out0, ostream& out1);
-	void analyse(list<Token>&tokens,const char* f0, const char* f1);
-	void analyse(list<Token>&tokens, const char* fileName);
-	vector<pair<int, pair<string,DType>>> getFuncEnter();
+	Parser(AnalyseTable* table, Interner* interner);
+	void setTrace(ParseTrace* trace);
+	void analyseLR(TokenStream&tokens);
+	void analyse(TokenStream&tokens,const char* f0, const char* f1);
+	void analyse(TokenStream&tokens, const char* fileName);
+	vector<pair<int, pair<Atom,DType>>> getFuncEnter();
 	IntermediateCode* getIntermediateCode();
+	// the number of shifts and reductions of the last analyse
+	size_t getShiftCount() const { return shiftCount; }
+	size_t getReductionCount() const { return reductionCount; }
 };
 
 #endif // !PARSER_H
\ No newline at end of file
@@ -0,0 +1,371 @@
+#include "ScanKernels.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SCAN_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// msvc compiles intrinsics of any instruction set without a flag
+#define SCAN_TARGET_AVX2
+#else
+// gcc and clang need the instruction set on the function
+#define SCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/**
+ * @brief index of the lowest set bit, mask must not be 0
+ */
+static inline unsigned lowestBit(unsigned mask) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (unsigned)index;
+#else
+	return (unsigned)__builtin_ctz(mask);
+#endif
+}
+
+/**
+ * @brief number of set bits
+ */
+static inline int countBits(unsigned mask) {
+#ifdef _MSC_VER
+	// popcnt is not part of SSE2
+	mask = mask - ((mask >> 1) & 0x55555555u);
+	mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+	return (int)((((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#else
+	return __builtin_popcount(mask);
+#endif
+}
+
+static inline bool isSpaceChar(char c) {
+	return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static inline bool isIdentifierChar(char c) {
+	return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+}
+
+// scalar kernels, also used for the tail shorter than a vector
+
+static const char* skipSpaceScalar(const char* p, const char* end, int& lines) {
+	while (p != end && isSpaceChar(*p)) {
+		if (*p == '\n') {
+			lines++;
+		}
+		p++;
+	}
+	return p;
+}
+
+static const char* skipIdentifierScalar(const char* p, const char* end) {
+	while (p != end && isIdentifierChar(*p)) {
+		p++;
+	}
+	return p;
+}
+
+static const char* skipDigitsScalar(const char* p, const char* end) {
+	while (p != end && *p >= '0' && *p <= '9') {
+		p++;
+	}
+	return p;
+}
+
+static const char* findCommentEndScalar(const char* p, const char* end) {
+	while (end - p >= 2) {
+		if (p[0] == '*' && p[1] == '/') {
+			return p;
+		}
+		p++;
+	}
+	return end;
+}
+
+static int countNewlinesScalar(const char* p, const char* end) {
+	return (int)count(p, end, '\n');
+}
+
+#ifdef SCAN_X86
+
+// SSE2 kernels, a compare gives 0xFF in every matching byte and movemask packs them into 16 bits
+
+static inline __m128i spaceMask16(__m128i v) {
+	// ' ' or '\t' .. '\r', bytes >= 0x80 are negative and fail the signed compare
+	__m128i space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+	__m128i control = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1)));
+	return _mm_or_si128(space, control);
+}
+
+static inline __m128i digitMask16(__m128i v) {
+	return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+}
+
+static inline __m128i identifierMask16(__m128i v) {
+	// fold upper case to lower case, then check 'a' .. 'z'
+	__m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+	__m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+	return _mm_or_si128(alpha, digitMask16(v));
+}
+
+static const char* skipSpaceSSE2(const char* p, const char* end, int& lines) {
+	// most runs are a single space between two tokens, do not load a vector for them
+	if (p != end && !isSpaceChar(*p)) {
+		return p;
+	}
+	if (p + 1 < end && *p == ' ' && !isSpaceChar(p[1])) {
+		return p + 1;
+	}
+	const __m128i newline = _mm_set1_epi8('\n');
+	while (end - p >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)p);
+		unsigned other = ~(unsigned)_mm_movemask_epi8(spaceMask16(v)) & 0xFFFFu;
+		unsigned newlines = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, newline));
+		if (other) {
+			unsigned n = lowestBit(other);
+			lines += countBits(newlines & ((1u << n) - 1));
+			return p + n;
+		}
+		lines += countBits(newlines);
+		p += 16;
+	}
+	return skipSpaceScalar(p, end, lines);
+}
+
+static const char* skipIdentifierSSE2(const char* p, const char* end) {
+	while (end - p >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)p);
+		unsigned other = ~(unsigned)_mm_movemask_epi8(identifierMask16(v)) & 0xFFFFu;
+		if (other) {
+			return p + lowestBit(other);
+		}
+		p += 16;
+	}
+	return skipIdentifierScalar(p, end);
+}
+
+static const char* skipDigitsSSE2(const char* p, const char* end) {
+	while (end - p >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)p);
+		unsigned other = ~(unsigned)_mm_movemask_epi8(digitMask16(v)) & 0xFFFFu;
+		if (other) {
+			return p + lowestBit(other);
+		}
+		p += 16;
+	}
+	return skipDigitsScalar(p, end);
+}
+
+static const char* findCommentEndSSE2(const char* p, const char* end) {
+	const __m128i star = _mm_set1_epi8('*');
+	const __m128i slash = _mm_set1_epi8('/');
+	// compare the block with itself shifted by one byte, so "*/" can not be missed at a block border
+	while (end - p >= 17) {
+		__m128i v0 = _mm_loadu_si128((const __m128i*)p);
+		__m128i v1 = _mm_loadu_si128((const __m128i*)(p + 1));
+		unsigned found = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(v0, star), _mm_cmpeq_epi8(v1, slash)));
+		if (found) {
+			return p + lowestBit(found);
+		}
+		p += 16;
+	}
+	return findCommentEndScalar(p, end);
+}
+
+static int countNewlinesSSE2(const char* p, const char* end) {
+	const __m128i newline = _mm_set1_epi8('\n');
+	int lines = 0;
+	while (end - p >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)p);
+		lines += countBits((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, newline)));
+		p += 16;
+	}
+	return lines + countNewlinesScalar(p, end);
+}
+
+// AVX2 kernels, the same as SSE2 with 32 bytes a time
+
+SCAN_TARGET_AVX2 static inline __m256i spaceMask32(__m256i v) {
+	__m256i space = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+	__m256i control = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('\t' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), v));
+	return _mm256_or_si256(space, control);
+}
+
+SCAN_TARGET_AVX2 static inline __m256i digitMask32(__m256i v) {
+	return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+}
+
+SCAN_TARGET_AVX2 static inline __m256i identifierMask32(__m256i v) {
+	__m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+	__m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+	return _mm256_or_si256(alpha, digitMask32(v));
+}
+
+SCAN_TARGET_AVX2 static const char* skipSpaceAVX2(const char* p, const char* end, int& lines) {
+	if (p != end && !isSpaceChar(*p)) {
+		return p;
+	}
+	if (p + 1 < end && *p == ' ' && !isSpaceChar(p[1])) {
+		return p + 1;
+	}
+	const __m256i newline = _mm256_set1_epi8('\n');
+	while (end - p >= 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)p);
+		unsigned other = ~(unsigned)_mm256_movemask_epi8(spaceMask32(v));
+		unsigned newlines = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, newline));
+		if (other) {
+			unsigned n = lowestBit(other);
+			lines += countBits(n == 0 ? 0 : newlines & (0xFFFFFFFFu >> (32 - n)));
+			return p + n;
+		}
+		lines += countBits(newlines);
+		p += 32;
+	}
+	return skipSpaceSSE2(p, end, lines);
+}
+
+SCAN_TARGET_AVX2 static const char* skipIdentifierAVX2(const char* p, const char* end) {
+	while (end - p >= 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)p);
+		unsigned other = ~(unsigned)_mm256_movemask_epi8(identifierMask32(v));
+		if (other) {
+			return p + lowestBit(other);
+		}
+		p += 32;
+	}
+	return skipIdentifierSSE2(p, end);
+}
+
+SCAN_TARGET_AVX2 static const char* skipDigitsAVX2(const char* p, const char* end) {
+	while (end - p >= 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)p);
+		unsigned other = ~(unsigned)_mm256_movemask_epi8(digitMask32(v));
+		if (other) {
+			return p + lowestBit(other);
+		}
+		p += 32;
+	}
+	return skipDigitsSSE2(p, end);
+}
+
+SCAN_TARGET_AVX2 static const char* findCommentEndAVX2(const char* p, const char* end) {
+	const __m256i star = _mm256_set1_epi8('*');
+	const __m256i slash = _mm256_set1_epi8('/');
+	while (end - p >= 33) {
+		__m256i v0 = _mm256_loadu_si256((const __m256i*)p);
+		__m256i v1 = _mm256_loadu_si256((const __m256i*)(p + 1));
+		unsigned found = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(v0, star), _mm256_cmpeq_epi8(v1, slash)));
+		if (found) {
+			return p + lowestBit(found);
+		}
+		p += 32;
+	}
+	return findCommentEndSSE2(p, end);
+}
+
+SCAN_TARGET_AVX2 static int countNewlinesAVX2(const char* p, const char* end) {
+	const __m256i newline = _mm256_set1_epi8('\n');
+	int lines = 0;
+	while (end - p >= 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)p);
+		lines += countBits((unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, newline)));
+		p += 32;
+	}
+	return lines + countNewlinesSSE2(p, end);
+}
+
+#endif // SCAN_X86
+
+static const ScanKernels scalarKernels = {
+	ScanLevel::Scalar, skipSpaceScalar, skipIdentifierScalar, skipDigitsScalar, findCommentEndScalar, countNewlinesScalar
+};
+
+#ifdef SCAN_X86
+static const ScanKernels sse2Kernels = {
+	ScanLevel::SSE2, skipSpaceSSE2, skipIdentifierSSE2, skipDigitsSSE2, findCommentEndSSE2, countNewlinesSSE2
+};
+
+static const ScanKernels avx2Kernels = {
+	ScanLevel::AVX2, skipSpaceAVX2, skipIdentifierAVX2, skipDigitsAVX2, findCommentEndAVX2, countNewlinesAVX2
+};
+#endif
+
+/**
+ * @brief find the best instruction set supported by the cpu and the operating system
+ * @return ScanLevel
+ */
+ScanLevel detectScanLevel() {
+#if defined(SCAN_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+	__cpuid(info, 1);
+	bool sse2 = (info[3] & (1 << 26)) != 0;
+	// the operating system must save the ymm registers
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	bool avx2 = false;
+	if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+	return avx2 ? ScanLevel::AVX2 : (sse2 ? ScanLevel::SSE2 : ScanLevel::Scalar);
+#elif defined(SCAN_X86)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return ScanLevel::AVX2;
+	}
+	if (__builtin_cpu_supports("sse2")) {
+		return ScanLevel::SSE2;
+	}
+	return ScanLevel::Scalar;
+#else
+	return ScanLevel::Scalar;
+#endif
+}
+
+/**
+ * @brief get the kernels of the best instruction set, the cpu is checked once
+ * @return const ScanKernels&
+ */
+const ScanKernels& getScanKernels() {
+	static const ScanKernels& best = getScanKernels(detectScanLevel());
+	return best;
+}
+
+/**
+ * @brief get the kernels of an instruction set
+ * @details if the cpu does not support it, the best supported instruction set below it is used
+ * @param level
+ * @return const ScanKernels&
+ */
+const ScanKernels& getScanKernels(ScanLevel level) {
+#ifdef SCAN_X86
+	ScanLevel supported = detectScanLevel();
+	if (level > supported) {
+		level = supported;
+	}
+	if (level == ScanLevel::AVX2) {
+		return avx2Kernels;
+	}
+	if (level == ScanLevel::SSE2) {
+		return sse2Kernels;
+	}
+#endif
+	return scalarKernels;
+}
+
+/**
+ * @brief get the name of an instruction set
+ * @param level
+ * @return const char*
+ */
+const char* scanLevelName(ScanLevel level) {
+	switch (level) {
+		case ScanLevel::AVX2: return "AVX2";
+		case ScanLevel::SSE2: return "SSE2";
+		default: return "scalar";
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef SCANKERNELS_H
+#define SCANKERNELS_H
+#include "utils.h"
+
+/**
+ * @file ScanKernels.h
+ * @brief vectorized scanning loops of the lexer, the instruction set is chosen at runtime
+ * @author chtholly
+ * @details every kernel looks at 16 (SSE2) or 32 (AVX2) bytes at a time and never reads past end,
+ * 		so it is safe on a mapped file. The char sets must agree with tokens.txt:
+ * 		identifier chars are [a-zA-Z0-9], digits are [0-9], spaces are ' ' and \t \n \v \f \r.
+ */
+
+/**
+ * @brief the instruction set used by the kernels
+ */
+enum class ScanLevel {
+	Scalar,						// one byte at a time
+	SSE2,						// 16 bytes at a time
+	AVX2						// 32 bytes at a time
+};
+
+/**
+ * @brief a set of scanning kernels for one instruction set
+ */
+struct ScanKernels {
+	ScanLevel level;
+	// skip spaces from p, add the number of '\n' skipped to lines, return the first other char or end
+	const char* (*skipSpace)(const char* p, const char* end, int& lines);
+	// return the first char from p which is not [a-zA-Z0-9], or end
+	const char* (*skipIdentifier)(const char* p, const char* end);
+	// return the first char from p which is not [0-9], or end
+	const char* (*skipDigits)(const char* p, const char* end);
+	// return the position of the first "*/" from p, or end if there is none
+	const char* (*findCommentEnd)(const char* p, const char* end);
+	// count '\n' in [p, end)
+	int (*countNewlines)(const char* p, const char* end);
+};
+
+// the best instruction set supported by this cpu
+ScanLevel detectScanLevel();
+// the kernels of the best instruction set, detected once
+const ScanKernels& getScanKernels();
+// the kernels of the given instruction set, or of the best supported one below it
+const ScanKernels& getScanKernels(ScanLevel level);
+// name of the instruction set
+const char* scanLevelName(ScanLevel level);
+
+#endif // !SCANKERNELS_H
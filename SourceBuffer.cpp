@@ -0,0 +1,168 @@
+#include "SourceBuffer.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * @brief Construct a new empty Source Buffer object
+ */
+SourceBuffer::SourceBuffer() {
+	data = "";
+	length = 0;
+	mapping = nullptr;
+#ifdef _WIN32
+	fileHandle = nullptr;
+	mapHandle = nullptr;
+#endif
+}
+
+/**
+ * @brief Destroy the Source Buffer object, unmap the file if it is mapped
+ */
+SourceBuffer::~SourceBuffer() {
+	close();
+}
+
+/**
+ * @brief open the source file
+ * @param path: the path of the source file
+ * @param mode: map the file or read it into memory
+ * @return true if the whole file is available through begin() and end()
+ */
+bool SourceBuffer::open(const char* path, SourceMode mode) {
+	close();
+	if (mode == SourceMode::Map && map(path)) {
+		return true;
+	}
+	return read(path);
+}
+
+/**
+ * @brief release the mapping or the heap copy of the file
+ */
+void SourceBuffer::close() {
+	unmap();
+	storage.clear();
+	storage.shrink_to_fit();
+	data = "";
+	length = 0;
+}
+
+/**
+ * @brief read the whole file into the heap buffer
+ * @param path: the path of the source file
+ * @return true if the file is read successfully
+ */
+bool SourceBuffer::read(const char* path) {
+	ifstream fin(path, ios::in | ios::binary);
+	if (!fin.is_open()) {
+		return false;
+	}
+	stringstream sstream;
+	sstream << fin.rdbuf();
+	storage = sstream.str();
+	data = storage.c_str();
+	length = storage.size();
+	return true;
+}
+
+#ifdef _WIN32
+
+/**
+ * @brief map the file into memory with CreateFileMapping and MapViewOfFile
+ * @param path: the path of the source file
+ * @return true if the file is mapped, false for an empty or unmappable file
+ */
+bool SourceBuffer::map(const char* path) {
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE fileMapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (fileMapping == NULL) {
+		CloseHandle(file);
+		return false;
+	}
+	void* view = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == NULL) {
+		CloseHandle(fileMapping);
+		CloseHandle(file);
+		return false;
+	}
+	fileHandle = file;
+	mapHandle = fileMapping;
+	mapping = view;
+	data = (const char*)view;
+	length = (size_t)fileSize.QuadPart;
+	return true;
+}
+
+/**
+ * @brief unmap the file and close the handles
+ */
+void SourceBuffer::unmap() {
+	if (mapping != nullptr) {
+		UnmapViewOfFile(mapping);
+		CloseHandle((HANDLE)mapHandle);
+		CloseHandle((HANDLE)fileHandle);
+		mapping = nullptr;
+		mapHandle = nullptr;
+		fileHandle = nullptr;
+	}
+}
+
+#else
+
+/**
+ * @brief map the file into memory with mmap
+ * @param path: the path of the source file
+ * @return true if the file is mapped, false for an empty or unmappable file
+ */
+bool SourceBuffer::map(const char* path) {
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+		::close(fd);
+		return false;
+	}
+	void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	// the mapping stays valid after the descriptor is closed
+	::close(fd);
+	if (view == MAP_FAILED) {
+		return false;
+	}
+	// the lexer reads the file from front to back exactly once
+	madvise(view, (size_t)st.st_size, MADV_SEQUENTIAL);
+	mapping = view;
+	data = (const char*)view;
+	length = (size_t)st.st_size;
+	return true;
+}
+
+/**
+ * @brief unmap the file
+ */
+void SourceBuffer::unmap() {
+	if (mapping != nullptr) {
+		munmap(mapping, length);
+		mapping = nullptr;
+	}
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef SOURCEBUFFER_H
+#define SOURCEBUFFER_H
+#include "utils.h"
+
+/**
+ * @brief how the source file is brought into memory
+ */
+enum class SourceMode {
+	Read,						// copy the whole file into a heap buffer
+	Map							// map the file into the address space, no copy at all
+};
+
+/**
+ * @brief a read-only, contiguous image of a source file
+ * @author chtholly
+ * @details the lexer scans this buffer directly, so tokens can be stored as (offset, length)
+ * 		views into it instead of owning their own strings. In Map mode the bytes come straight
+ * 		from the page cache; if the file cannot be mapped (empty file, pipe...) it falls back to Read.
+ */
+class SourceBuffer {
+private:
+	const char* data;			// first byte of the source
+	size_t length;				// number of bytes in the source
+	string storage;				// backing store in Read mode
+	void* mapping;				// address returned by the system when the file is mapped
+#ifdef _WIN32
+	void* fileHandle;			// handle of the mapped file
+	void* mapHandle;			// handle of the file mapping object
+#endif
+
+	bool map(const char* path);
+	bool read(const char* path);
+	void unmap();
+public:
+	SourceBuffer();
+	~SourceBuffer();
+	SourceBuffer(const SourceBuffer&) = delete;
+	SourceBuffer& operator=(const SourceBuffer&) = delete;
+	// open the file, return false if it could not be read
+	bool open(const char* path, SourceMode mode);
+	// release the buffer
+	void close();
+	// getter
+	const char* begin() const { return data; }
+	const char* end() const { return data + length; }
+	size_t size() const { return length; }
+	bool isMapped() const { return mapping != nullptr; }
+};
+
+#endif // !SOURCEBUFFER_H
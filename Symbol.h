@@ -13,9 +13,11 @@ class Symbol {
 public:
 	bool isVt; 		//true for terminal symbol, false for non-terminal symbol
 	string content;	//the content of the symbol
+	int id;			//the id of the symbol in the analyse table, -1 if it has none
 	friend bool operator ==(const Symbol&one, const Symbol&other);
 	friend bool operator < (const Symbol&one, const Symbol&other);
 	Symbol(const Symbol& sym);
+	Symbol& operator=(const Symbol& sym) = default;
 	Symbol(const bool &isVt, const string& content);
 	Symbol();
 };
@@ -44,109 +46,5 @@ struct Production {
 	vector<Symbol>right;// right symbols
 };
 
-// a series of special symbols
-class Id :public Symbol {
-public:
-	string name;
-	Id(const Symbol& sym, const string& name);
-};
-
-class Num :public Symbol {
-public:
-	string number;
-	Num(const Symbol& sym,const string& number);
-};
-
-class FunctionDeclare :public Symbol {
-public:
-	list<DType>plist;
-	FunctionDeclare(const Symbol& sym);
-};
-
-class Parameter :public Symbol {
-public:
-	list<DType>plist;
-	Parameter(const Symbol& sym);
-};
-
-class ParameterList :public Symbol {
-public:
-	list<DType>plist;
-	ParameterList(const Symbol& sym);
-};
-
-class SentenceBlock :public Symbol {
-public:
-	list<int>nextList;
-	SentenceBlock(const Symbol& sym);
-};
-
-class SentenceList :public Symbol {
-public:
-	list<int>nextList;
-	SentenceList(const Symbol& sym);
-};
-
-class Sentence :public Symbol {
-public:
-	list<int>nextList;
-	Sentence(const Symbol& sym);
-};
-
-class WhileSentence :public Symbol {
-public:
-	list<int>nextList;
-	WhileSentence(const Symbol& sym);
-};
-
-class IfSentence :public Symbol {
-public:
-	list<int>nextList;
-	IfSentence(const Symbol& sym);
-};
-
-class Expression :public Symbol {
-public:
-	string name;
-	list<int>falseList;
-	Expression(const Symbol& sym);
-};
-
-class M :public Symbol {
-public:
-	int quad;
-	M(const Symbol& sym);
-};
-
-class N :public Symbol {
-public:
-	list<int> nextList;
-	N(const Symbol& sym);
-};
-
-class AddExpression :public Symbol {
-public:
-	string name;
-	AddExpression(const Symbol& sym);
-};
-
-class Nomial :public Symbol {
-public:
-	string name;
-	Nomial(const Symbol& sym);
-};
-
-class Factor :public Symbol {
-public:
-	string name;
-	Factor(const Symbol& sym);
-};
-
-class ArgumentList :public Symbol {
-public:
-	list<string> alist;
-	ArgumentList(const Symbol& sym);
-};
-
 
 #endif // !SYMBOL_H
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef TERMINALTABLE_H
+#define TERMINALTABLE_H
+#include "Token.h"
+
+/**
+ * @file TerminalTable.h
+ * @brief perfect hash table of keywords and terminal symbols, built at compile time
+ * @author chtholly
+ * @details shared by the lexer (keyword or identifier) and the grammar loader (terminal or non-terminal).
+ * 		The hash is gperf style, hash = length + assoc[first char] + assoc[last char], and the assoc values
+ * 		are chosen so that every terminal gets its own slot. A lookup is one hash and a single string comparison.
+ * 		The TokenType of a terminal is also its terminal id in the grammar.
+ */
+
+/**
+ * @brief a terminal symbol
+ */
+struct TerminalEntry {
+	const char* text;			// spelling of the terminal, in the source or in productions.txt
+	size_t length;				// length of the spelling, 0 for an empty slot
+	TokenType type;				// the token type, also the terminal id
+	bool lexeme;				// false if the terminal is only spelled this way in the grammar, like ID and NUM
+};
+
+// number of slots of the hash table, also the assoc value of chars which never start or end a terminal
+#define TERMINAL_HASH_SIZE 28
+
+// all terminals of the grammar
+constexpr TerminalEntry terminalKeys[] = {
+	{ "if", 2, IF, true }, { "else", 4, ELSE, true }, { "int", 3, INT, true },
+	{ "return", 6, RETURN, true }, { "void", 4, VOID, true }, { "while", 5, WHILE, true },
+	{ "{", 1, LBRACE, true }, { "}", 1, RBRACE, true }, { ">=", 2, GTE, true }, { "<=", 2, LTE, true },
+	{ "!=", 2, NEQ, true }, { "==", 2, EQ, true }, { "=", 1, ASSIGN, true }, { "<", 1, LT, true },
+	{ ">", 1, GT, true }, { "+", 1, PLUS, true }, { "-", 1, MINUS, true }, { "*", 1, MULT, true },
+	{ "/", 1, DIV, true }, { "(", 1, LPAREN, true }, { ")", 1, RPAREN, true }, { ";", 1, SEMI, true },
+	{ ",", 1, COMMA, true }, { "#", 1, ENDFILE, true }, { "ID", 2, ID, false }, { "NUM", 3, NUM, false }
+};
+
+#define TERMINAL_COUNT (sizeof(terminalKeys) / sizeof(terminalKeys[0]))
+
+struct TerminalAssoc {
+	unsigned char value[256];
+};
+
+struct TerminalHashTable {
+	TerminalEntry slot[TERMINAL_HASH_SIZE];
+};
+
+/**
+ * @brief the assoc value of each char
+ */
+constexpr TerminalAssoc buildTerminalAssoc() {
+	TerminalAssoc assoc{};
+	for (int c = 0; c < 256; c++) {
+		assoc.value[c] = TERMINAL_HASH_SIZE;
+	}
+	assoc.value['!'] = 5;  assoc.value['#'] = 7;  assoc.value['('] = 8;  assoc.value[')'] = 4;
+	assoc.value['*'] = 12; assoc.value['+'] = 5;  assoc.value[','] = 9;  assoc.value['-'] = 10;
+	assoc.value['/'] = 2;  assoc.value[';'] = 11; assoc.value['<'] = 3;  assoc.value['='] = 1;
+	assoc.value['>'] = 13; assoc.value['{'] = 6;  assoc.value['}'] = 0;  assoc.value['D'] = 20;
+	assoc.value['I'] = 4;  assoc.value['M'] = 11; assoc.value['N'] = 10; assoc.value['d'] = 16;
+	assoc.value['e'] = 5;  assoc.value['f'] = 0;  assoc.value['i'] = 8;  assoc.value['n'] = 0;
+	assoc.value['r'] = 16; assoc.value['t'] = 1;  assoc.value['v'] = 0;  assoc.value['w'] = 8;
+	return assoc;
+}
+
+constexpr TerminalAssoc terminalAssoc = buildTerminalAssoc();
+
+/**
+ * @brief the hash value of a non-empty string
+ */
+constexpr size_t terminalHash(const char* text, size_t length) {
+	return length + terminalAssoc.value[(unsigned char)text[0]] + terminalAssoc.value[(unsigned char)text[length - 1]];
+}
+
+/**
+ * @brief put every terminal into its slot
+ */
+constexpr TerminalHashTable buildTerminalHashTable() {
+	TerminalHashTable table{};
+	for (size_t i = 0; i < TERMINAL_COUNT; i++) {
+		size_t h = terminalHash(terminalKeys[i].text, terminalKeys[i].length);
+		table.slot[h].text = terminalKeys[i].text;
+		table.slot[h].length = terminalKeys[i].length;
+		table.slot[h].type = terminalKeys[i].type;
+		table.slot[h].lexeme = terminalKeys[i].lexeme;
+	}
+	return table;
+}
+
+/**
+ * @brief check that every terminal has its own slot inside the table
+ */
+constexpr bool terminalHashIsPerfect() {
+	for (size_t i = 0; i < TERMINAL_COUNT; i++) {
+		size_t h = terminalHash(terminalKeys[i].text, terminalKeys[i].length);
+		if (h >= TERMINAL_HASH_SIZE) {
+			return false;
+		}
+		for (size_t j = 0; j < i; j++) {
+			if (terminalHash(terminalKeys[j].text, terminalKeys[j].length) == h) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static_assert(terminalHashIsPerfect(), "the assoc values do not give a perfect hash of the terminals, choose them again");
+
+constexpr TerminalHashTable terminalHashTable = buildTerminalHashTable();
+
+/**
+ * @brief find a terminal by its spelling
+ * @param text: the spelling, does not need to be terminated by 0
+ * @param length: the length of the spelling
+ * @return const TerminalEntry*: the terminal, nullptr if it is not a terminal
+ */
+static inline const TerminalEntry* lookupTerminal(const char* text, size_t length) {
+	if (length == 0) {
+		return nullptr;
+	}
+	size_t h = terminalHash(text, length);
+	if (h >= TERMINAL_HASH_SIZE) {
+		return nullptr;
+	}
+	const TerminalEntry* entry = &terminalHashTable.slot[h];
+	if (entry->length != length || memcmp(entry->text, text, length) != 0) {
+		return nullptr;
+	}
+	return entry;
+}
+
+#endif // !TERMINALTABLE_H
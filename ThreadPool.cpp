@@ -0,0 +1,90 @@
+#include "ThreadPool.h"
+
+/**
+ * @brief Construct a new Thread Pool object and start its workers
+ * @param threads: number of threads with the one calling run(), 0 for one per core
+ */
+ThreadPool::ThreadPool(int threads) {
+	if (threads <= 0) {
+		threads = (int)thread::hardware_concurrency();
+	}
+	task = nullptr;
+	count = 0;
+	next = 0;
+	active = 0;
+	generation = 0;
+	stopping = false;
+	for (int i = 1; i < threads; i++) {
+		workers.push_back(thread(&ThreadPool::work, this));
+	}
+}
+
+/**
+ * @brief Destroy the Thread Pool object, stop and join the workers
+ */
+ThreadPool::~ThreadPool() {
+	{
+		lock_guard<mutex> guard(lock);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+}
+
+/**
+ * @brief the loop of a worker, wait for a loop to run, run it, and tell run() when done
+ */
+void ThreadPool::work() {
+	uint64_t seen = 0;
+	while (true) {
+		{
+			unique_lock<mutex> guard(lock);
+			wake.wait(guard, [&]() { return stopping || generation != seen; });
+			if (stopping) {
+				return;
+			}
+			seen = generation;
+		}
+		drain();
+		{
+			lock_guard<mutex> guard(lock);
+			active--;
+		}
+		finished.notify_one();
+	}
+}
+
+void ThreadPool::drain() {
+	for (size_t i = next++; i < count; i = next++) {
+		(*task)(i);
+	}
+}
+
+/**
+ * @brief run a loop on all threads of the pool
+ * @details a loop of one iteration, or a pool without workers, runs in the calling thread alone
+ * @param count: number of iterations
+ * @param task: the body of the loop, called with the index of the iteration
+ */
+void ThreadPool::run(size_t count, const function<void(size_t)>& task) {
+	if (workers.empty() || count < 2) {
+		for (size_t i = 0; i < count; i++) {
+			task(i);
+		}
+		return;
+	}
+	{
+		lock_guard<mutex> guard(lock);
+		this->task = &task;
+		this->count = count;
+		next = 0;
+		active = (int)workers.size();
+		generation++;
+	}
+	wake.notify_all();
+	drain();
+	unique_lock<mutex> guard(lock);
+	finished.wait(guard, [&]() { return active == 0; });
+}
@@ -0,0 +1,44 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+#include "utils.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/**
+ * @brief a fixed set of threads which run the iterations of a loop
+ * @author chtholly
+ * @details run() hands the indices of a loop out one by one to the workers and to the calling thread,
+ * 		and returns when all of them are done. The threads live as long as the pool, so a loop run many
+ * 		times does not start threads each time.
+ */
+class ThreadPool {
+private:
+	vector<thread> workers;
+	mutex lock;
+	condition_variable wake;					// a loop is started or the pool is stopping
+	condition_variable finished;				// a worker is done with the loop
+	const function<void(size_t)>* task;			// the body of the current loop
+	size_t count;								// number of iterations of the current loop
+	atomic<size_t> next;						// the next iteration to hand out
+	int active;									// workers still in the current loop
+	uint64_t generation;						// number of loops started
+	bool stopping;
+
+	void work();
+	// run the iterations left of the current loop
+	void drain();
+public:
+	// start the threads, the calling thread of run() is one of them, 0 for one per core
+	explicit ThreadPool(int threads = 0);
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	~ThreadPool();
+	// call task(i) for each i in [0, count), in any order and thread
+	void run(size_t count, const function<void(size_t)>& task);
+	// number of threads running a loop, with the calling one
+	int size() const { return (int)workers.size() + 1; }
+};
+
+#endif // !THREADPOOL_H
@@ -28,23 +28,45 @@ typedef enum
 } TokenType;
 
 
+class Interner;
+
+// name of a token type
+const char* tokenTypeName(TokenType type);
+
 class Token{
 private:
 	TokenType type;
-	string value;
+	Atom value;
 
 public:
-	Token(TokenType type, string value) :type(type), value(value) {};
-	Token(string value);
-	// if the token is a reserved word
-	bool isReservedWord();
+	Token(TokenType type, Atom value) :type(type), value(value) {};
     // getter and setter
 	TokenType getType() { return type; }
-	string getValue() { return value; }
+	Atom getValue() { return value; }
 	void setType(TokenType type) { this->type = type; }
-	void setValue(string value) { this->value = value; }
+	void setValue(Atom value) { this->value = value; }
 	// transform Token to string
-	string toString();
+	string toString(const Interner& interner);
+};
+
+/**
+ * @brief a token which refers to the source buffer instead of owning its text
+ * @details the text of the token is [offset, offset + length) in the source,
+ * 		atom is the interned text, NO_ATOM for comments and errors
+ */
+struct TokenView {
+	TokenType type;
+	uint32_t offset;
+	uint32_t length;
+	Atom atom;
+};
+
+/**
+ * @brief a place in the source, both count from 1
+ */
+struct SourcePosition {
+	int line;
+	int column;
 };
 
 #endif // !TOKEN_H
\ No newline at end of file
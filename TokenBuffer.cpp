@@ -0,0 +1,70 @@
+#include "TokenBuffer.h"
+#include "LexicalAnalyser.h"
+
+/**
+ * @brief Construct an empty Token Buffer object
+ */
+TokenBuffer::TokenBuffer() {
+	reset(nullptr, nullptr, &getScanKernels());
+}
+
+/**
+ * @brief forget all tokens and the line index
+ * @param begin: first char of the source
+ * @param end: one past the last char of the source
+ * @param scan: the scanning kernels to match tokens with
+ */
+void TokenBuffer::reset(const char* begin, const char* end, const ScanKernels* scan) {
+	base = begin;
+	limit = end;
+	this->scan = scan;
+	types.clear();
+	offsets.clear();
+	names.clear();
+	lineStarts.clear();
+}
+
+/**
+ * @brief get the length of a token
+ * @details the lexer is deterministic, so matching at the offset gives the same token again.
+ * 		The end of file has no text, and an unclosed comment matches to the end of the source like its error token.
+ * @param index
+ * @return uint32_t
+ */
+uint32_t TokenBuffer::length(size_t index) const {
+	if (type(index) == ENDFILE) {
+		return 0;
+	}
+	const char* begin = base + offsets[index];
+	return uint32_t(LexicalAnalyser::matchToken(*scan, begin, limit).end - begin);
+}
+
+/**
+ * @brief get the line and column of an offset
+ * @details the line starts are found when this is called the first time, then each call is a binary search
+ * @param offset
+ * @return SourcePosition
+ */
+SourcePosition TokenBuffer::position(uint32_t offset) const {
+	if (lineStarts.empty()) {
+		lineStarts.push_back(0);
+		for (const char* p = base; p != limit; p++) {
+			p = (const char*)memchr(p, '\n', limit - p);
+			if (p == nullptr) {
+				break;
+			}
+			lineStarts.push_back(uint32_t(p + 1 - base));
+		}
+	}
+	size_t line = upper_bound(lineStarts.begin(), lineStarts.end(), offset) - lineStarts.begin();
+	return SourcePosition{ (int)line, (int)(offset - lineStarts[line - 1]) + 1 };
+}
+
+/**
+ * @brief get the memory used by the buffer
+ * @return size_t
+ */
+size_t TokenBuffer::memoryUsage() const {
+	return types.capacity() * sizeof(uint8_t) + offsets.capacity() * sizeof(uint32_t) + names.capacity() * sizeof(Atom)
+		+ lineStarts.capacity() * sizeof(uint32_t);
+}
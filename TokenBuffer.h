@@ -0,0 +1,55 @@
+#ifndef TOKENBUFFER_H
+#define TOKENBUFFER_H
+#include "utils.h"
+#include "Token.h"
+#include "Interner.h"
+#include "ScanKernels.h"
+
+/**
+ * @brief the tokens of a whole source, stored as parallel arrays
+ * @author chtholly
+ * @details a token is only its type and the offset of its first char, five bytes in all, and an identifier or
+ * 		a number keeps its atom as well, so the tokens can be parsed without being matched again.
+ * 		Everything else can be found again from the source: the length by matching the token at its offset,
+ * 		the line and column from an index of the line starts, which is built at the first position asked for,
+ * 		usually by an error message. The source must stay in memory as long as the buffer is used.
+ */
+class TokenBuffer {
+private:
+	const char* base;							// first char of the source
+	const char* limit;							// one past the last char of the source
+	const ScanKernels* scan;					// used to match a token again for its length
+	vector<uint8_t> types;						// type of each token
+	vector<uint32_t> offsets;					// offset of the first char of each token
+	vector<Atom> names;							// atom of each identifier and number, in the order of the tokens
+	mutable vector<uint32_t> lineStarts;		// offset of the first char of each line, empty till it is needed
+public:
+	TokenBuffer();
+	// forget the tokens and the line index, and refer to a new source
+	void reset(const char* begin, const char* end, const ScanKernels* scan);
+	// add a token at the end
+	void push(TokenType type, uint32_t offset, Atom atom = NO_ATOM) {
+		types.push_back((uint8_t)type);
+		offsets.push_back(offset);
+		if (type == ID || type == NUM) {
+			names.push_back(atom);
+		}
+	}
+	// change the type of a token
+	void setType(size_t index, TokenType type) { types[index] = (uint8_t)type; }
+	// getter
+	size_t size() const { return types.size(); }
+	bool empty() const { return types.empty(); }
+	TokenType type(size_t index) const { return (TokenType)types[index]; }
+	uint32_t offset(size_t index) const { return offsets[index]; }
+	// the atom of the index-th identifier or number
+	Atom name(size_t index) const { return names[index]; }
+	// the length of a token, found by matching it again
+	uint32_t length(size_t index) const;
+	// the line and column of an offset of the source
+	SourcePosition position(uint32_t offset) const;
+	// bytes taken by the tokens and the line index
+	size_t memoryUsage() const;
+};
+
+#endif // !TOKENBUFFER_H
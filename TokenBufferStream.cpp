@@ -0,0 +1,60 @@
+#include "TokenBufferStream.h"
+
+/**
+ * @brief Construct a Token Buffer Stream object without tokens, reset() gives it its buffer
+ */
+TokenBufferStream::TokenBufferStream() {
+	tokens = nullptr;
+	interner = nullptr;
+	index = 0;
+	nameIndex = 0;
+	lastOffset = 0;
+}
+
+/**
+ * @brief read a buffer from its first token
+ * @param tokens: the tokens of LexicalAnalyser::analyse()
+ * @param interner: the interner they were lexed with
+ * @param errorText: the error message of the lexer, if the buffer ends with an ERROR token
+ */
+void TokenBufferStream::reset(const TokenBuffer* tokens, Interner* interner, const string& errorText) {
+	this->tokens = tokens;
+	this->interner = interner;
+	this->errorText = errorText;
+	index = 0;
+	nameIndex = 0;
+	lastOffset = 0;
+}
+
+/**
+ * @brief pull the next token of the buffer
+ * @return Token: the token, ENDFILE after the last one
+ */
+Token TokenBufferStream::next() {
+	if (index == tokens->size()) {
+		return Token(ENDFILE, interner->terminal(ENDFILE));
+	}
+	TokenType type = tokens->type(index);
+	lastOffset = tokens->offset(index);
+	index++;
+	if (type == ID || type == NUM) {
+		return Token(type, tokens->name(nameIndex++));
+	}
+	return Token(type, interner->terminal(type));
+}
+
+/**
+ * @brief get the error message of the ERROR token
+ * @return string
+ */
+string TokenBufferStream::getErrorText() {
+	return errorText;
+}
+
+/**
+ * @brief get the line and column of the last token pulled by next()
+ * @return SourcePosition
+ */
+SourcePosition TokenBufferStream::position() {
+	return tokens->position(lastOffset);
+}
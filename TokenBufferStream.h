@@ -0,0 +1,33 @@
+#ifndef TOKENBUFFERSTREAM_H
+#define TOKENBUFFERSTREAM_H
+#include "TokenStream.h"
+#include "TokenBuffer.h"
+#include "Interner.h"
+
+/**
+ * @brief the tokens of a TokenBuffer read as a TokenStream
+ * @author chtholly
+ * @details a large source is lexed at once by LexicalAnalyser::analyse(), in several threads, and the parser
+ * 		pulls the tokens from the buffer through this stream. The buffer keeps the atoms of the identifiers and numbers,
+ * 		the ones of the other terminals come from the interner, so a token is not matched again.
+ * 		The buffer and the interner must outlive the stream.
+ */
+class TokenBufferStream :public TokenStream {
+private:
+	const TokenBuffer* tokens;			// the tokens read
+	Interner* interner;					// the interner the tokens were lexed with
+	size_t index;						// the next token
+	size_t nameIndex;					// the atom of the next identifier or number
+	uint32_t lastOffset;				// offset of the last token returned by next()
+	string errorText;					// the error message of the ERROR token of the buffer
+public:
+	TokenBufferStream();
+	// read the tokens from the first one
+	void reset(const TokenBuffer* tokens, Interner* interner, const string& errorText);
+	// pull the next token, see TokenStream
+	Token next();
+	string getErrorText();
+	SourcePosition position();
+};
+
+#endif // !TOKENBUFFERSTREAM_H
@@ -0,0 +1,22 @@
+#ifndef TOKENSTREAM_H
+#define TOKENSTREAM_H
+#include "Token.h"
+
+/**
+ * @brief a source of tokens which the parser pulls one at a time
+ * @author chtholly
+ * @details the tokens are produced when they are asked for, so nobody has to keep the whole list.
+ * 		After the end of the input next() returns ENDFILE again and again.
+ */
+class TokenStream {
+public:
+	virtual ~TokenStream() {}
+	// get the next token
+	virtual Token next() = 0;
+	// the error message of the last ERROR token
+	virtual string getErrorText() = 0;
+	// the line and column of the last token returned by next()
+	virtual SourcePosition position() = 0;
+};
+
+#endif // !TOKENSTREAM_H
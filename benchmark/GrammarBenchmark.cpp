@@ -0,0 +1,156 @@
+#include "../table.h"
+#include <atomic>
+#include <new>
+
+/**
+ * @file GrammarBenchmark.cpp
+ * @brief measure how building the tables of AnalyseTable scales with the grammar
+ * @author chtholly
+ * @details build it with the table sources, for example
+ * 		g++ -O2 -std=c++14 benchmark/GrammarBenchmark.cpp table.cpp CombTable.cpp ThreadPool.cpp Symbol.cpp SourceBuffer.cpp utils.cpp -lpthread
+ * 		usage: GrammarBenchmark [grammar...], run it in the directory of productions.txt. By default it reads
+ * 		productions.txt, the grammars of benchmark/grammars and two generated grammars of blocks nested 16 and 64 deep.
+ * 		The grammars of benchmark/grammars are subsets of ANSI C and Java written with the terminals of the lexer,
+ * 		in the format of productions.txt.
+ * 		For each grammar it reports the time of each step of the build, the best of several rounds, the states,
+ * 		the share of the entries of the dense tables which are not errors, and the peak of the heap during a build.
+ */
+
+// the bytes the heap holds now and at most, counted by the operators below
+static atomic<size_t> liveBytes(0);
+static atomic<size_t> peakBytes(0);
+// the size is kept in front of each block, in a header which keeps the alignment of malloc
+static const size_t HEADER_SIZE = 16;
+
+void* operator new(size_t size) {
+	char* block = (char*)malloc(size + HEADER_SIZE);
+	if (block == nullptr) {
+		throw bad_alloc();
+	}
+	*(size_t*)block = size;
+	size_t live = liveBytes += size;
+	size_t peak = peakBytes;
+	while (live > peak && !peakBytes.compare_exchange_weak(peak, live)) {
+	}
+	return block + HEADER_SIZE;
+}
+
+void operator delete(void* pointer) noexcept {
+	if (pointer == nullptr) {
+		return;
+	}
+	char* block = (char*)pointer - HEADER_SIZE;
+	liveBytes -= *(size_t*)block;
+	free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+	operator delete(pointer);
+}
+
+/**
+ * @brief write a grammar of nested blocks, where each depth has its own statements and expressions
+ * @details the parser knows the depth from its stack, so the grammar is LALR(1) at any depth,
+ * 		and its productions and states grow linearly with the depth
+ * @param path
+ * @param depth
+ */
+static void writeNestedGrammar(const string& path, int depth) {
+	ofstream fout(path, ios::out);
+	fout << "S ::= b0" << endl;
+	for (int i = 0; i < depth; i++) {
+		string n = to_string(i);
+		fout << "b" << n << " ::= { l" << n << " }" << endl;
+		fout << "l" << n << " ::= l" << n << " s" << n << endl;
+		fout << "l" << n << " ::= s" << n << endl;
+		fout << "s" << n << " ::= ID = e" << n << " ;" << endl;
+		fout << "s" << n << " ::= return e" << n << " ;" << endl;
+		fout << "s" << n << " ::= if ( e" << n << " ) b" << i + 1 << endl;
+		fout << "s" << n << " ::= if ( e" << n << " ) b" << i + 1 << " else b" << i + 1 << endl;
+		fout << "s" << n << " ::= while ( e" << n << " ) b" << i + 1 << endl;
+		fout << "e" << n << " ::= e" << n << " + t" << n << endl;
+		fout << "e" << n << " ::= e" << n << " - t" << n << endl;
+		fout << "e" << n << " ::= t" << n << endl;
+		fout << "t" << n << " ::= t" << n << " * f" << n << endl;
+		fout << "t" << n << " ::= t" << n << " / f" << n << endl;
+		fout << "t" << n << " ::= f" << n << endl;
+		fout << "f" << n << " ::= ID" << endl;
+		fout << "f" << n << " ::= NUM" << endl;
+		fout << "f" << n << " ::= ( e" << n << " )" << endl;
+		fout << "f" << n << " ::= ID ( e" << n << " )" << endl;
+	}
+	fout << "b" << depth << " ::= { }" << endl;
+}
+
+int main(int argc, char* argv[]) {
+	vector<string> grammars;
+	for (int i = 1; i < argc; i++) {
+		grammars.push_back(argv[i]);
+	}
+	vector<string> generated;
+	if (grammars.empty()) {
+		grammars = { "productions.txt", "benchmark/grammars/c_subset.txt", "benchmark/grammars/java_subset.txt" };
+		for (int depth : { 16, 64 }) {
+			string path = "bench_nested_" + to_string(depth) + ".txt";
+			writeNestedGrammar(path, depth);
+			grammars.push_back(path);
+			generated.push_back(path);
+		}
+	}
+
+	cout << setw(36) << left << "grammar" << right << setw(6) << "prods" << setw(7) << "states"
+		<< setw(9) << "read" << setw(9) << "first" << setw(9) << "dfa" << setw(9) << "lalr" << setw(9) << "pack"
+		<< setw(9) << "total" << setw(8) << "action" << setw(7) << "goto" << setw(10) << "peak" << endl;
+	cout << setw(58) << "ms" << setw(45) << "filled %" << setw(10) << "KB" << endl;
+	const int rounds = 5;
+	for (const string& grammar : grammars) {
+		TableBuildTimes best{ 1e100,1e100,1e100,1e100,1e100 };
+		double bestTotal = 1e100;
+		size_t peak = 0;
+		for (int i = 0; i < rounds; i++) {
+			errorMessage.clear();
+			size_t base = liveBytes;
+			peakBytes = base;
+			AnalyseTable table(grammar.c_str(), false);
+			peak = max(peak, peakBytes - base);
+			const TableBuildTimes& times = table.getBuildTimes();
+			best.read = min(best.read, times.read);
+			best.firstFollow = min(best.firstFollow, times.firstFollow);
+			best.automaton = min(best.automaton, times.automaton);
+			best.lookaheads = min(best.lookaheads, times.lookaheads);
+			best.pack = min(best.pack, times.pack);
+			bestTotal = min(bestTotal, times.read + times.firstFollow + times.automaton + times.lookaheads + times.pack);
+		}
+
+		errorMessage.clear();
+		AnalyseTable table(grammar.c_str(), false);
+		int states = table.getStateCount();
+		int terminals = table.getTerminalCount();
+		int nonTerminals = table.getSymbolCount() - terminals;
+		size_t actions = 0;
+		size_t gotos = 0;
+		for (int s = 0; s < states; s++) {
+			for (int t = 0; t < terminals; t++) {
+				actions += table.action(s, t) != 0;
+			}
+			for (int n = 0; n < nonTerminals; n++) {
+				gotos += table.goTo(s, terminals + n) != 0;
+			}
+		}
+		cout << setw(36) << left << grammar << right << setw(6) << table.getProductions().size() << setw(7) << states
+			<< fixed << setprecision(3) << setw(9) << best.read * 1e3 << setw(9) << best.firstFollow * 1e3
+			<< setw(9) << best.automaton * 1e3 << setw(9) << best.lookaheads * 1e3 << setw(9) << best.pack * 1e3
+			<< setw(9) << bestTotal * 1e3 << setprecision(1)
+			<< setw(8) << 100.0 * actions / max<size_t>((size_t)states * terminals, 1)
+			<< setw(7) << 100.0 * gotos / max<size_t>((size_t)states * nonTerminals, 1)
+			<< setw(10) << peak / 1024 << endl;
+		if (!errorMessage.empty()) {
+			cout << "  " << errorMessage << endl;
+		}
+	}
+	for (const string& path : generated) {
+		remove(path.c_str());
+	}
+	errorMessage.clear();
+	return 0;
+}
@@ -0,0 +1,73 @@
+#include "../Parser.h"
+#include "../LexicalAnalyser.h"
+#include "SourceGenerator.h"
+#include <chrono>
+
+/**
+ * @file LazyTableBenchmark.cpp
+ * @brief compare the time to the first parse of an eager and a lazy table, and the states the lazy one builds
+ * @author chtholly
+ * @details build it with the compiler sources, for example
+ * 		g++ -O2 -std=c++14 -I. benchmark/LazyTableBenchmark.cpp benchmark/SourceGenerator.cpp Parser.cpp IntermediateCode.cpp LexicalAnalyser.cpp ScanKernels.cpp SourceBuffer.cpp Interner.cpp ParseTrace.cpp Token.cpp TokenBuffer.cpp table.cpp CombTable.cpp ThreadPool.cpp Symbol.cpp utils.cpp -lpthread
+ * 		usage: LazyTableBenchmark [grammar] [source...], run it in the directory of productions.txt.
+ * 		The sources are generated programs of 200 bytes and 20 KB by default, so they only parse with that grammar.
+ * 		Both tables are SLR(1) and built without the cache, the time is the one of the table and the parse together.
+ */
+
+/**
+ * @brief build a table and parse a source with it
+ * @return double: seconds
+ */
+static double firstParse(const string& grammar, const string& source, StateConstruction construction, int& built, int& found) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	AnalyseTable table(grammar.c_str(), false, LookaheadMode::SLR, construction);
+	Interner interner;
+	LexicalAnalyser lexer(source.c_str(), &interner);
+	Parser parser(&table, &interner);
+	parser.analyseLR(lexer);
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+	built = table.getBuiltStateCount();
+	found = table.getStateCount();
+	return elapsed.count();
+}
+
+int main(int argc, char* argv[]) {
+	string grammar = argc > 1 ? argv[1] : "productions.txt";
+	vector<string> sources;
+	for (int i = 2; i < argc; i++) {
+		sources.push_back(argv[i]);
+	}
+	vector<string> generated;
+	if (sources.empty()) {
+		for (size_t size : { 200, 20000 }) {
+			string path = "bench_source_" + to_string(size) + ".txt";
+			ofstream fout(path, ios::out | ios::binary);
+			fout << generateSource(size, IDENTIFIER_HEAVY);
+			sources.push_back(path);
+			generated.push_back(path);
+		}
+	}
+
+	const int rounds = 5;
+	for (const string& source : sources) {
+		cout << source << endl;
+		for (StateConstruction construction : { StateConstruction::Eager, StateConstruction::Lazy }) {
+			double best = 1e100;
+			int built = 0;
+			int found = 0;
+			for (int i = 0; i < rounds; i++) {
+				errorMessage.clear();
+				best = min(best, firstParse(grammar, source, construction, built, found));
+			}
+			cout << setw(8) << left << (construction == StateConstruction::Eager ? "eager" : "lazy") << right
+				<< setw(6) << built << " states built" << setw(6) << found << " found"
+				<< setw(10) << fixed << setprecision(2) << best * 1e3 << " ms"
+				<< (errorMessage.empty() ? "" : "  " + errorMessage) << endl;
+		}
+	}
+	for (const string& path : generated) {
+		remove(path.c_str());
+	}
+	errorMessage.clear();
+	return 0;
+}
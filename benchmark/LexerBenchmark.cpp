@@ -0,0 +1,111 @@
+#include "../LexicalAnalyser.h"
+#include "SourceGenerator.h"
+#include <chrono>
+#include <thread>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * @file LexerBenchmark.cpp
+ * @brief measure LexicalAnalyser::analyse on generated sources of a given size and token mix,
+ * 		once for every instruction set of the scanning kernels in one thread, then with the best one on every core
+ * @author chtholly
+ * @details build it with the lexer sources, for example
+ * 		g++ -O2 -std=c++14 benchmark/LexerBenchmark.cpp benchmark/SourceGenerator.cpp LexicalAnalyser.cpp ScanKernels.cpp SourceBuffer.cpp Interner.cpp Token.cpp TokenBuffer.cpp utils.cpp -lpthread
+ * 		usage: LexerBenchmark [size in MB] [mix...]
+ * 		a mix is identifier, operator, comment, or id%:name length:operators:comment%, all three named ones by default.
+ * 		The peak memory is the one of the whole process, run one mix at a time to compare it.
+ */
+
+/**
+ * @brief the most memory the process has used so far, in bytes
+ */
+static size_t peakMemory() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return counters.PeakWorkingSetSize;
+	}
+	return 0;
+#else
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+	return (size_t)usage.ru_maxrss;
+#else
+	return (size_t)usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+/**
+ * @brief lex the file several times with one instruction set and number of threads, print the best throughput
+ */
+static void run(const string& title, const char* path, size_t size, ScanLevel level, int threads) {
+	const int rounds = 5;
+	double best = 1e100;
+	size_t tokenCount = 0;
+	size_t memory = 0;
+	for (int i = 0; i < rounds; i++) {
+		Interner interner;
+		LexicalAnalyser lexer(path, &interner);
+		lexer.setScanLevel(level);
+		lexer.setThreads(threads, 0);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		lexer.analyse();
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+		best = min(best, elapsed.count());
+		tokenCount = lexer.getTokens().size();
+		memory = lexer.getTokens().memoryUsage();
+	}
+	cout << setw(18) << left << title << setw(8) << scanLevelName(level) << right << setw(3) << threads << " threads"
+		<< setw(10) << fixed << setprecision(1) << size / best / 1e6 << " MB/s"
+		<< setw(12) << setprecision(2) << tokenCount / best / 1e6 << " Mtokens/s"
+		<< setw(8) << setprecision(1) << (double)memory / tokenCount << " bytes/token" << endl;
+}
+
+int main(int argc, char* argv[]) {
+	size_t size = (size_t)((argc > 1 ? atof(argv[1]) : 32) * 1000 * 1000);
+	vector<string> mixes;
+	for (int i = 2; i < argc; i++) {
+		mixes.push_back(argv[i]);
+	}
+	if (mixes.empty()) {
+		mixes = { "identifier", "operator", "comment" };
+	}
+
+	int cores = (int)thread::hardware_concurrency();
+	cout << "best instruction set of this cpu: " << scanLevelName(detectScanLevel()) << ", cores: " << cores << endl;
+	const char* path = "bench_source.txt";
+	for (size_t i = 0; i < mixes.size(); i++) {
+		TokenMix mix;
+		if (!parseTokenMix(mixes[i], mix)) {
+			cerr << "unknown token mix " << mixes[i] << endl;
+			return 1;
+		}
+		size_t sourceSize;
+		{
+			string source = generateSource(size, mix);
+			sourceSize = source.size();
+			ofstream fout(path, ios::out | ios::binary);
+			fout << source;
+		}
+		string title = mixes[i].find(':') == string::npos ? mixes[i] + " heavy" : mixes[i];
+		for (ScanLevel level : { ScanLevel::Scalar, ScanLevel::SSE2, ScanLevel::AVX2 }) {
+			if (level <= detectScanLevel()) {
+				run(title, path, sourceSize, level, 1);
+			}
+		}
+		if (cores > 1) {
+			run(title, path, sourceSize, detectScanLevel(), cores);
+		}
+		cout << setw(18) << left << title << right << "peak memory " << setprecision(1) << peakMemory() / 1e6 << " MB" << endl;
+		remove(path);
+	}
+	return 0;
+}
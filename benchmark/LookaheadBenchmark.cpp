@@ -0,0 +1,171 @@
+#include "../table.h"
+#include <chrono>
+
+/**
+ * @file LookaheadBenchmark.cpp
+ * @brief compare the SLR(1) and LALR(1) tables of AnalyseTable with the canonical LR(1) automaton
+ * @author chtholly
+ * @details build it with the table sources, for example
+ * 		g++ -O2 -std=c++14 benchmark/LookaheadBenchmark.cpp table.cpp CombTable.cpp ThreadPool.cpp Symbol.cpp SourceBuffer.cpp utils.cpp -lpthread
+ * 		usage: LookaheadBenchmark [grammar...], productions.txt by default.
+ * 		SLR(1) and LALR(1) share the LR(0) states, so the interesting numbers are their build times and conflicts,
+ * 		against the number of states and the build time of the canonical LR(1) automaton, which is built here.
+ */
+
+// an lr(1) item, the lookahead is the index of a terminal
+struct CanonicalItem {
+	int pro;
+	int pointPos;
+	int lookahead;
+	bool operator <(const CanonicalItem& other) const {
+		return pro != other.pro ? pro < other.pro : pointPos != other.pointPos ? pointPos < other.pointPos : lookahead < other.lookahead;
+	}
+};
+
+/**
+ * @brief count the states of the canonical LR(1) automaton of a grammar
+ */
+static size_t canonicalStateCount(const vector<Production>& productions) {
+	// number the symbols, the terminals and the non-terminals apart
+	map<string, int> terminals, nonTerminals;
+	terminals["#"] = 0;
+	for (const Production& production : productions) {
+		nonTerminals.insert(make_pair(production.left.content, (int)nonTerminals.size()));
+	}
+	for (const Production& production : productions) {
+		for (const Symbol& symbol : production.right) {
+			if (symbol.isVt) {
+				terminals.insert(make_pair(symbol.content, (int)terminals.size()));
+			}
+		}
+	}
+	// FIRST of the non-terminals, and which ones derive EMPTY
+	vector<set<int> > first(nonTerminals.size());
+	vector<bool> nullable(nonTerminals.size(), false);
+	bool updated = true;
+	while (updated) {
+		updated = false;
+		for (const Production& production : productions) {
+			int left = nonTerminals[production.left.content];
+			size_t i = 0;
+			for (; i < production.right.size(); i++) {
+				const Symbol& symbol = production.right[i];
+				if (symbol.isVt) {
+					updated |= first[left].insert(terminals[symbol.content]).second;
+					break;
+				}
+				int n = nonTerminals[symbol.content];
+				for (int t : first[n]) {
+					updated |= first[left].insert(t).second;
+				}
+				if (!nullable[n]) {
+					break;
+				}
+			}
+			if (i == production.right.size() && !nullable[left]) {
+				nullable[left] = updated = true;
+			}
+		}
+	}
+	auto closure = [&](set<CanonicalItem> items) {
+		vector<CanonicalItem> pending(items.begin(), items.end());
+		while (!pending.empty()) {
+			CanonicalItem item = pending.back();
+			pending.pop_back();
+			const vector<Symbol>& right = productions[item.pro].right;
+			if (item.pointPos == (int)right.size() || right[item.pointPos].isVt) {
+				continue;
+			}
+			// the lookaheads of the derived items, FIRST of what follows the non-terminal then the lookahead
+			set<int> lookaheads;
+			size_t i = item.pointPos + 1;
+			for (; i < right.size(); i++) {
+				if (right[i].isVt) {
+					lookaheads.insert(terminals[right[i].content]);
+					break;
+				}
+				int n = nonTerminals[right[i].content];
+				lookaheads.insert(first[n].begin(), first[n].end());
+				if (!nullable[n]) {
+					break;
+				}
+			}
+			if (i == right.size()) {
+				lookaheads.insert(item.lookahead);
+			}
+			for (size_t pro = 0; pro < productions.size(); pro++) {
+				if (productions[pro].left == right[item.pointPos]) {
+					for (int lookahead : lookaheads) {
+						CanonicalItem derived{ (int)pro, 0, lookahead };
+						if (items.insert(derived).second) {
+							pending.push_back(derived);
+						}
+					}
+				}
+			}
+		}
+		return items;
+	};
+
+	map<set<CanonicalItem>, int> states;
+	vector<set<CanonicalItem> > order;
+	order.push_back(closure(set<CanonicalItem>{ CanonicalItem{ 0, 0, 0 } }));
+	states[order[0]] = 0;
+	for (size_t s = 0; s < order.size(); s++) {
+		map<string, set<CanonicalItem> > kernels;
+		for (const CanonicalItem& item : order[s]) {
+			if (item.pointPos < (int)productions[item.pro].right.size()) {
+				kernels[productions[item.pro].right[item.pointPos].content].insert(CanonicalItem{ item.pro, item.pointPos + 1, item.lookahead });
+			}
+		}
+		for (auto& kernel : kernels) {
+			set<CanonicalItem> next = closure(kernel.second);
+			if (states.count(next) == 0) {
+				states[next] = (int)order.size();
+				order.push_back(next);
+			}
+		}
+	}
+	return order.size();
+}
+
+int main(int argc, char* argv[]) {
+	vector<string> grammars;
+	for (int i = 1; i < argc; i++) {
+		grammars.push_back(argv[i]);
+	}
+	if (grammars.empty()) {
+		grammars.push_back("productions.txt");
+	}
+
+	const int rounds = 5;
+	for (const string& grammar : grammars) {
+		cout << grammar << endl;
+		for (LookaheadMode mode : { LookaheadMode::SLR, LookaheadMode::LALR }) {
+			double best = 1e100;
+			int states = 0;
+			string conflict;
+			for (int i = 0; i < rounds; i++) {
+				errorMessage.clear();
+				chrono::steady_clock::time_point start = chrono::steady_clock::now();
+				AnalyseTable table(grammar.c_str(), false, mode);
+				chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+				best = min(best, elapsed.count());
+				states = table.getStateCount();
+				conflict = errorMessage;
+			}
+			cout << setw(8) << left << (mode == LookaheadMode::SLR ? "SLR" : "LALR") << right << setw(8) << states << " states"
+				<< setw(10) << fixed << setprecision(2) << best * 1e3 << " ms"
+				<< "  " << (conflict.empty() ? "no conflict" : conflict) << endl;
+		}
+		errorMessage.clear();
+		AnalyseTable table(grammar.c_str(), false);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		size_t states = canonicalStateCount(table.getProductions());
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+		cout << setw(8) << left << "LR(1)" << right << setw(8) << states << " states"
+			<< setw(10) << fixed << setprecision(2) << elapsed.count() * 1e3 << " ms" << endl;
+	}
+	errorMessage.clear();
+	return 0;
+}
@@ -0,0 +1,118 @@
+#include "../table.h"
+#include <chrono>
+#include <random>
+
+/**
+ * @file ParseTableBenchmark.cpp
+ * @brief compare the size and the lookup latency of the dense and the compressed parse tables
+ * @author chtholly
+ * @details build it with the table sources, for example
+ * 		g++ -O2 -std=c++14 benchmark/ParseTableBenchmark.cpp table.cpp CombTable.cpp ThreadPool.cpp Symbol.cpp SourceBuffer.cpp utils.cpp -lpthread
+ * 		usage: ParseTableBenchmark [grammar...], productions.txt by default.
+ * 		The lookups are the entries the parser can ask for, the actions and gotos which are not errors,
+ * 		in a random order, so a table which does not fit in the cache pays for it.
+ */
+
+// a lookup of the benchmark, a terminal or a non-terminal in a state
+struct Lookup {
+	int state;
+	int symbol;
+};
+
+/**
+ * @brief look all entries up several times with the current backend, return the best time of one lookup
+ * @param checksum: sum of the entries, so the lookups are not optimized away
+ */
+static double timeLookups(const AnalyseTable& table, const vector<Lookup>& lookups, long long& checksum) {
+	const int rounds = 5;
+	const size_t repeat = max<size_t>(1, 10000000 / lookups.size());
+	int terminalCount = table.getTerminalCount();
+	double best = 1e100;
+	for (int i = 0; i < rounds; i++) {
+		long long sum = 0;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (size_t r = 0; r < repeat; r++) {
+			for (const Lookup& lookup : lookups) {
+				sum += lookup.symbol < terminalCount ? table.action(lookup.state, lookup.symbol)
+					: table.goTo(lookup.state, lookup.symbol);
+			}
+		}
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+		best = min(best, elapsed.count() / (repeat * lookups.size()));
+		checksum += sum;
+	}
+	return best;
+}
+
+int main(int argc, char* argv[]) {
+	vector<string> grammars;
+	for (int i = 1; i < argc; i++) {
+		grammars.push_back(argv[i]);
+	}
+	if (grammars.empty()) {
+		grammars.push_back("productions.txt");
+	}
+
+	for (const string& grammar : grammars) {
+		AnalyseTable table(grammar.c_str(), false);
+		if (!errorMessage.empty()) {
+			cerr << errorMessage;
+			errorMessage.clear();
+		}
+		int stateCount = table.getStateCount();
+		int terminalCount = table.getTerminalCount();
+		int symbolCount = table.getSymbolCount();
+		if (stateCount == 0) {
+			cerr << "no tables for " << grammar << endl;
+			continue;
+		}
+
+		// the entries which are not errors, and the expected values
+		vector<Lookup> lookups;
+		vector<TableEntry> expected;
+		for (int state = 0; state < stateCount; state++) {
+			for (int symbol = 0; symbol < symbolCount; symbol++) {
+				TableEntry entry = symbol < terminalCount ? table.action(state, symbol) : table.goTo(state, symbol);
+				if (entry != 0) {
+					lookups.push_back(Lookup{ state, symbol });
+					expected.push_back(entry);
+				}
+			}
+		}
+		size_t denseSize = table.tableSize();
+		long long checksum = 0;
+		vector<size_t> order(lookups.size());
+		for (size_t i = 0; i < order.size(); i++) {
+			order[i] = i;
+		}
+		shuffle(order.begin(), order.end(), mt19937(1));
+		vector<Lookup> shuffled(lookups.size());
+		for (size_t i = 0; i < order.size(); i++) {
+			shuffled[i] = lookups[order[i]];
+		}
+		double denseTime = timeLookups(table, shuffled, checksum);
+
+		table.setBackend(TableBackend::Comb);
+		size_t combSize = table.tableSize();
+		// the compressed tables must give every entry which is not an error
+		size_t mismatches = 0;
+		for (size_t i = 0; i < lookups.size(); i++) {
+			const Lookup& lookup = lookups[i];
+			TableEntry entry = lookup.symbol < terminalCount ? table.action(lookup.state, lookup.symbol)
+				: table.goTo(lookup.state, lookup.symbol);
+			mismatches += entry != expected[i];
+		}
+		double combTime = timeLookups(table, shuffled, checksum);
+
+		cout << grammar << ": " << stateCount << " states, " << symbolCount << " symbols, "
+			<< lookups.size() << " entries" << (mismatches ? ", MISMATCHES " + to_string(mismatches) : string()) << endl;
+		cout << setw(8) << left << "dense" << right << setw(10) << denseSize << " bytes"
+			<< setw(8) << fixed << setprecision(2) << denseTime * 1e9 << " ns/lookup" << endl;
+		cout << setw(8) << left << "comb" << right << setw(10) << combSize << " bytes"
+			<< setw(8) << fixed << setprecision(2) << combTime * 1e9 << " ns/lookup" << endl;
+		if (checksum == 0) {
+			cout << endl;
+		}
+	}
+	return 0;
+}
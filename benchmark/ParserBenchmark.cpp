@@ -0,0 +1,117 @@
+#include "../Parser.h"
+#include "../LexicalAnalyser.h"
+#include "SourceGenerator.h"
+#include <chrono>
+#include <atomic>
+#include <new>
+
+/**
+ * @file ParserBenchmark.cpp
+ * @brief count the reductions the parser does for each token, and measure the parse, on generated sources
+ * @author chtholly
+ * @details build it with the compiler sources, for example
+ * 		g++ -O2 -std=c++14 -I. benchmark/ParserBenchmark.cpp benchmark/SourceGenerator.cpp Parser.cpp IntermediateCode.cpp LexicalAnalyser.cpp ScanKernels.cpp SourceBuffer.cpp Interner.cpp ParseTrace.cpp Token.cpp TokenBuffer.cpp table.cpp CombTable.cpp ThreadPool.cpp Symbol.cpp utils.cpp -lpthread
+ * 		usage: ParserBenchmark [size in MB] [mix...], run it in the directory of productions.txt.
+ * 		A mix is identifier, operator, comment, or id%:name length:operators:comment%, all three named ones by default.
+ * 		Every reduction pops the entries of its right side, pushes the one of its left side and looks the goto up, so the
+ * 		reductions per token is what a grammar costs the parser beyond reading the tokens.
+ * 		The heap allocations of a parse are counted by the operators below, the semantic values live in the parse stack.
+ * 		The parse is measured again with a ParseTrace, which records the pushes and pops of the stack.
+ */
+
+// the calls of operator new since the start
+static atomic<size_t> heapAllocations(0);
+
+// the replaced new and delete are a matching pair of malloc and free, g++ only sees free called on a pointer of operator new
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void* operator new(size_t size) {
+	heapAllocations++;
+	void* block = malloc(size == 0 ? 1 : size);
+	if (block == nullptr) {
+		throw bad_alloc();
+	}
+	return block;
+}
+
+void operator delete(void* pointer) noexcept {
+	free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+	free(pointer);
+}
+#pragma GCC diagnostic pop
+
+int main(int argc, char* argv[]) {
+	size_t size = (size_t)((argc > 1 ? atof(argv[1]) : 4) * 1000 * 1000);
+	vector<string> mixes;
+	for (int i = 2; i < argc; i++) {
+		mixes.push_back(argv[i]);
+	}
+	if (mixes.empty()) {
+		mixes = { "identifier", "operator", "comment" };
+	}
+
+	AnalyseTable table("productions.txt");
+	if (errorMessage != "") {
+		cerr << errorMessage << endl;
+		return 1;
+	}
+	const char* path = "bench_source.txt";
+	for (size_t i = 0; i < mixes.size(); i++) {
+		TokenMix mix;
+		if (!parseTokenMix(mixes[i], mix)) {
+			cerr << "unknown token mix " << mixes[i] << endl;
+			return 1;
+		}
+		size_t sourceSize;
+		{
+			string source = generateSource(size, mix);
+			sourceSize = source.size();
+			ofstream fout(path, ios::out | ios::binary);
+			fout << source;
+		}
+		const int rounds = 3;
+		double best = 1e100;
+		double bestTraced = 1e100;
+		size_t shifts = 0;
+		size_t reductions = 0;
+		size_t allocations = 0;
+		size_t traceBytes = 0;
+		ParseTrace trace;
+		for (int round = 0; round < 2 * rounds; round++) {
+			// the odd rounds are traced
+			bool traced = round % 2 == 1;
+			Interner interner;
+			LexicalAnalyser lexer(path, &interner);
+			Parser parser(&table, &interner);
+			parser.setTrace(traced ? &trace : nullptr);
+			errorMessage.clear();
+			size_t allocated = heapAllocations;
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			parser.analyseLR(lexer);
+			chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+			if (traced) {
+				bestTraced = min(bestTraced, elapsed.count());
+				traceBytes = trace.size();
+				continue;
+			}
+			allocations = heapAllocations - allocated;
+			best = min(best, elapsed.count());
+			shifts = parser.getShiftCount();
+			reductions = parser.getReductionCount();
+		}
+		string title = mixes[i].find(':') == string::npos ? mixes[i] + " heavy" : mixes[i];
+		cout << setw(18) << left << title << right << setw(10) << shifts << " tokens" << setw(10) << reductions << " reductions"
+			<< setw(8) << fixed << setprecision(2) << (double)reductions / shifts << " per token"
+			<< setw(8) << (double)allocations / shifts << " news per token"
+			<< setw(10) << setprecision(1) << sourceSize / best / 1e6 << " MB/s"
+			<< setw(8) << setprecision(2) << (double)traceBytes / shifts << " trace bytes per token"
+			<< setw(8) << setprecision(1) << sourceSize / bestTraced / 1e6 << " MB/s traced"
+			<< (errorMessage.empty() ? "" : "  " + errorMessage) << endl;
+		remove(path);
+	}
+	errorMessage.clear();
+	return 0;
+}
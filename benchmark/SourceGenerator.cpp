@@ -0,0 +1,213 @@
+#include "SourceGenerator.h"
+#include <random>
+
+const TokenMix IDENTIFIER_HEAVY = { 90, 24, 2, 5 };
+const TokenMix OPERATOR_HEAVY = { 50, 1, 12, 0 };
+const TokenMix COMMENT_HEAVY = { 50, 6, 3, 80 };
+
+/**
+ * @brief read a token mix from the command line
+ * @param text: a named mix, or four numbers separated by ':'
+ * @param mix: the result
+ * @return true if the text is a mix
+ */
+bool parseTokenMix(const string& text, TokenMix& mix) {
+	if (text == "identifier") {
+		mix = IDENTIFIER_HEAVY;
+		return true;
+	}
+	if (text == "operator") {
+		mix = OPERATOR_HEAVY;
+		return true;
+	}
+	if (text == "comment") {
+		mix = COMMENT_HEAVY;
+		return true;
+	}
+	return sscanf(text.c_str(), "%d:%d:%d:%d", &mix.identifierPercent, &mix.nameLength, &mix.operatorCount, &mix.commentPercent) == 4
+		&& mix.nameLength >= 1 && mix.operatorCount >= 0;
+}
+
+/**
+ * @brief writes one program, the random choices are taken from a fixed seed
+ */
+class SourceWriter {
+private:
+	const TokenMix& mix;
+	mt19937 random;
+	string out;
+	vector<string> variables;		// variables of the function being written
+	vector<string> functions;		// functions written so far, they all have two parameters
+	int depth;						// nesting of the blocks
+
+	// true with the given percent
+	bool chance(int percent) { return (int)(random() % 100) < percent; }
+	// a name of the given length from a prefix and a number
+	string name(const char* prefix, int number);
+	void indent() { out.append(depth, '\t'); }
+	void comment();
+	void operand();
+	void expression(int operators);
+	void block();
+	void statement();
+	void function(int number, size_t size);
+public:
+	SourceWriter(const TokenMix& mix, unsigned seed) : mix(mix), random(seed), depth(0) {}
+	string write(size_t size);
+};
+
+/**
+ * @brief a name which starts with a letter, padded with letters to the length of the mix
+ */
+string SourceWriter::name(const char* prefix, int number) {
+	string text = prefix + to_string(number);
+	while ((int)text.size() < mix.nameLength) {
+		text.push_back('a' + (char)(random() % 26));
+	}
+	return text;
+}
+
+void SourceWriter::comment() {
+	indent();
+	if (chance(50)) {
+		out += "// the value is kept between the calls, see the note above\n";
+	}
+	else {
+		out += "/*\n";
+		for (int i = 0, lines = 1 + random() % 4; i < lines; i++) {
+			indent();
+			out += " * a paragraph comment about the statement below, 42 * x + y\n";
+		}
+		indent();
+		out += " */\n";
+	}
+}
+
+void SourceWriter::operand() {
+	if (!chance(mix.identifierPercent)) {
+		out += to_string(random() % 100000);
+	}
+	else if (!functions.empty() && chance(10) && depth < 8) {
+		out += functions[random() % functions.size()] + "(";
+		expression(1);
+		out += ", ";
+		expression(1);
+		out += ")";
+	}
+	else {
+		out += variables[random() % variables.size()];
+	}
+}
+
+/**
+ * @brief an add_expression with up to the given number of operators
+ */
+void SourceWriter::expression(int operators) {
+	static const char* ops[] = { " + ", " - ", " * ", " / " };
+	int count = operators > 0 ? random() % (operators + 1) : 0;
+	operand();
+	for (int i = 0; i < count; i++) {
+		out += ops[random() % 4];
+		if (chance(15)) {
+			out += "(";
+			expression(operators / 2);
+			out += ")";
+		}
+		else {
+			operand();
+		}
+	}
+}
+
+void SourceWriter::block() {
+	indent();
+	out += "{\n";
+	depth++;
+	for (int i = 0, count = 1 + random() % 3; i < count; i++) {
+		statement();
+	}
+	depth--;
+	indent();
+	out += "}\n";
+}
+
+void SourceWriter::statement() {
+	static const char* compares[] = { " > ", " < ", " == ", " >= ", " <= ", " != " };
+	if (chance(mix.commentPercent)) {
+		comment();
+	}
+	indent();
+	int kind = depth < 3 ? random() % 10 : 0;
+	if (kind == 8 || kind == 9) {
+		out += kind == 8 ? "while (" : "if (";
+		expression(mix.operatorCount);
+		out += compares[random() % 6];
+		expression(mix.operatorCount);
+		out += ")\n";
+		block();
+		if (kind == 9 && chance(50)) {
+			indent();
+			out += "else\n";
+			block();
+		}
+	}
+	else {
+		out += variables[random() % variables.size()] + " = ";
+		expression(mix.operatorCount);
+		out += ";\n";
+	}
+}
+
+/**
+ * @brief a function with two parameters and some locals, about the given size
+ */
+void SourceWriter::function(int number, size_t size) {
+	string fname = name("f", number);
+	variables.clear();
+	variables.push_back(name("p", 0));
+	variables.push_back(name("p", 1));
+	out += "int " + fname + "(int " + variables[0] + ", int " + variables[1] + ")\n{\n";
+	depth = 1;
+	for (int i = 0, count = 1 + random() % 4; i < count; i++) {
+		variables.push_back(name("v", i));
+		out += "\tint " + variables.back() + ";\n";
+	}
+	// the compiler wants every variable to be set before it is used
+	for (size_t i = 2; i < variables.size(); i++) {
+		out += "\t" + variables[i] + " = " + to_string(random() % 100) + ";\n";
+	}
+	size_t end = out.size() + size;
+	while (out.size() < end) {
+		statement();
+	}
+	out += "\treturn ";
+	expression(mix.operatorCount);
+	out += ";\n}\n\n";
+	depth = 0;
+	functions.push_back(fname);
+}
+
+/**
+ * @brief write functions till the size is reached, then the main function
+ */
+string SourceWriter::write(size_t size) {
+	out.clear();
+	out.reserve(size + 4096);
+	for (int number = 0; out.size() < size; number++) {
+		function(number, 2048);
+	}
+	out += "void main(void)\n{\n\tint a;\n\ta = 0;\n\treturn ;\n}\n";
+	return out;
+}
+
+/**
+ * @brief generate a program
+ * @param size: the least size of the program in bytes
+ * @param mix: the kind of tokens
+ * @param seed: seed of the random choices
+ * @return string: the program
+ */
+string generateSource(size_t size, const TokenMix& mix, unsigned seed) {
+	SourceWriter writer(mix, seed);
+	return writer.write(size);
+}
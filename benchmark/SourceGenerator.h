@@ -0,0 +1,33 @@
+#ifndef SOURCEGENERATOR_H
+#define SOURCEGENERATOR_H
+#include "../utils.h"
+
+/**
+ * @file SourceGenerator.h
+ * @brief synthetic sources for the benchmarks
+ * @author chtholly
+ * @details the sources are programs of the grammar in productions.txt, so they can be parsed as well as lexed.
+ * 		The same size, mix and seed always give the same source.
+ */
+
+/**
+ * @brief the kind of tokens a generated source is made of
+ */
+struct TokenMix {
+	int identifierPercent;		// operands which are variables or calls, the others are numbers
+	int nameLength;				// length of the names of variables and functions
+	int operatorCount;			// binary operators in an expression, at most
+	int commentPercent;			// statements which are preceded by a comment
+};
+
+// the mixes which can be named on the command line
+extern const TokenMix IDENTIFIER_HEAVY;
+extern const TokenMix OPERATOR_HEAVY;
+extern const TokenMix COMMENT_HEAVY;
+
+// read a mix from "identifier", "operator", "comment" or "id%:length:operators:comment%"
+bool parseTokenMix(const string& text, TokenMix& mix);
+// generate a program of at least size bytes
+string generateSource(size_t size, const TokenMix& mix, unsigned seed = 1);
+
+#endif // !SOURCEGENERATOR_H
@@ -8,10 +8,17 @@ Compiler::Compiler(const char* ProductionFile)
 {
     errorMessage = "";
     this->state = CompilerState::Wait;
+    this->failedStage = CompilerState::Wait;
     this->lexicalAnalyser = nullptr;
+    this->tokenStream = nullptr;
     this->parser = nullptr;
+    this->tracing = false;
     this->analyseTable = new AnalyseTable(ProductionFile);
-    this->analyseTable->outputDFA("DFA.txt");
+    // the DFA only changes with the grammar, the tables of an unchanged grammar come from the cache
+    if(this->analyseTable->isRebuilt() || !ifstream("DFA.txt").is_open())
+    {
+        this->analyseTable->outputDFA("DFA.txt");
+    }
     this->errorMes = "";
     if(errorMessage != "")
     {
@@ -28,6 +35,15 @@ CompilerState Compiler::getState()
     return this->state;
 }
 
+/**
+ * @brief get the stage which failed, the tokens are read while parsing but an error of the lexer is still a lexical one
+ * @return CompilerState: Wait if no stage failed
+ */
+CompilerState Compiler::getFailedStage()
+{
+    return this->failedStage;
+}
+
 /**
  * @brief get the error message
  * @return string 
@@ -60,12 +76,25 @@ string Compiler::getSourceFile(){
  */
 void Compiler::lexicalAnalyse(){
     this->state = CompilerState::LexicalAnalyse;
-    this->lexicalAnalyser = new LexicalAnalyser(this->sourceFile.c_str());
-    this->lexicalAnalyser->analyse();
-    this->lexicalAnalyser->outputToFile("lexical.txt");
+    this->lexicalAnalyser = new LexicalAnalyser(this->sourceFile.c_str(), &this->interner);
+    if (this->lexicalAnalyser->analysesInParallel())
+    {
+        // a large source is lexed at once in several threads, and parsed from the tokens kept
+        this->lexicalAnalyser->analyse();
+        this->lexicalAnalyser->outputToFile("lexical.txt");
+        this->bufferStream.reset(&this->lexicalAnalyser->getTokens(), &this->interner, this->lexicalAnalyser->getErrorText());
+        this->tokenStream = &this->bufferStream;
+    }
+    else
+    {
+        // the tokens are scanned when the parser pulls them, and written into lexical.txt on the way
+        this->lexicalAnalyser->echoToFile("lexical.txt");
+        this->tokenStream = this->lexicalAnalyser;
+    }
     this->errorMes = errorMessage;
     if (errorMessage != "")
     {
+        this->failedStage = this->state;
         this->state = CompilerState::Error;
     }
 }
@@ -75,14 +104,31 @@ void Compiler::lexicalAnalyse(){
  */
 void Compiler::syntaxAnalyse(){
     this->state = CompilerState::SyntaxAnalyse;
-    list<Token> tokens = this->lexicalAnalyser->getResult();
-    this->parser = new Parser(this->analyseTable);
-    this->parser->analyse(tokens, "symbol.txt", "state.txt");
-    this->errorMes = errorMessage;
+    this->parser = new Parser(this->analyseTable, &this->interner);
+    // the stacks are not printed while parsing, only recorded if they may be shown
+    this->parser->setTrace(this->tracing ? &this->parseTrace : nullptr);
+    this->parser->analyseLR(*this->tokenStream);
     if (errorMessage != "")
     {
+        // the parse stopped early, the rest of the tokens are still read so lexical.txt is complete,
+        // and an error of the lexer anywhere in the source is reported before the syntax error
+        if (this->tokenStream == this->lexicalAnalyser && !this->lexicalAnalyser->hasError())
+        {
+            Token token = this->lexicalAnalyser->next();
+            while (token.getType() != ENDFILE && token.getType() != ERROR)
+            {
+                token = this->lexicalAnalyser->next();
+            }
+        }
+        this->failedStage = this->state;
+        if (this->lexicalAnalyser->hasError())
+        {
+            outputError(this->lexicalAnalyser->getErrorText());
+            this->failedStage = CompilerState::LexicalAnalyse;
+        }
         this->state = CompilerState::Error;
     }
+    this->errorMes = errorMessage;
 }
 
 /**
@@ -93,7 +139,7 @@ void Compiler::objectCodeGenerate(){
     IntermediateCode* code = this->parser->getIntermediateCode();
     code->divideBlocks(this->parser->getFuncEnter());
 
-    ObjectCodeGenerator objectCodeGenerator;
+    ObjectCodeGenerator objectCodeGenerator(&this->interner);
 	objectCodeGenerator.analyseBlock(code->getFuncBlock());
     this->state = CompilerState::ObjectCodeGenerate;
 	objectCodeGenerator.outputIBlocks("intermediate.txt");
@@ -103,6 +149,7 @@ void Compiler::objectCodeGenerate(){
     this->errorMes = errorMessage;
     if (errorMessage != "")
     {
+        this->failedStage = this->state;
         this->state = CompilerState::Error;
     }
     else
@@ -111,14 +158,58 @@ void Compiler::objectCodeGenerate(){
     }
 }
 
+/**
+ * @brief record the symbol stack and the state stack of the next compilations, they are not recorded by default
+ * @param tracing 
+ */
+void Compiler::setTracing(bool tracing)
+{
+    this->tracing = tracing;
+    if (!tracing)
+    {
+        this->parseTrace.clear();
+    }
+}
+
+/**
+ * @brief output the symbol stack of each step of the last parse, rebuilt from its trace
+ * @param out 
+ */
+void Compiler::outputSymbolStack(ostream& out)
+{
+    ostream nowhere(nullptr);
+    this->parseTrace.output(out, nowhere, this->analyseTable->getSymbols());
+}
+
+/**
+ * @brief output the state stack of each step of the last parse, rebuilt from its trace
+ * @param out 
+ */
+void Compiler::outputStateStack(ostream& out)
+{
+    ostream nowhere(nullptr);
+    this->parseTrace.output(nowhere, out, this->analyseTable->getSymbols());
+}
+
 /**
  * @brief use the compiler to compile the source file and generate the object file
  */
 void Compiler::compile(const char* sourceFile)
 {
+    // the atoms of the last compilation are not used any more
+    this->interner.clear();
     this->setSourceFile(sourceFile);
     lexicalAnalyse();
+    // a stage which failed leaves nothing the next one can use
+    if (this->state == CompilerState::Error)
+    {
+        return;
+    }
     syntaxAnalyse();
+    if (this->state == CompilerState::Error)
+    {
+        return;
+    }
     objectCodeGenerate();
 }
 
@@ -1,6 +1,7 @@
 #include "LexicalAnalyser.h"
 #include "Parser.h"
 #include "ObjectCodeGenerator.h"
+#include "TokenBufferStream.h"
 
 #ifndef COMPILER_H
 #define COMPILER_H
@@ -24,7 +25,13 @@ class Compiler
 private:
     string errorMes;
     CompilerState state;
+    CompilerState failedStage;
+    Interner interner;
+    ParseTrace parseTrace;
+    bool tracing;
     LexicalAnalyser* lexicalAnalyser;
+    TokenBufferStream bufferStream;
+    TokenStream* tokenStream;
     AnalyseTable* analyseTable;
     Parser* parser;
     string sourceFile;
@@ -34,12 +41,16 @@ public:
     ~Compiler();
     void compile(const char* sourceFile);
     CompilerState getState();
+    CompilerState getFailedStage();
     string getErrorMessage();
     string getSourceFile();
     void setSourceFile(string sourceFile);
     void lexicalAnalyse();
     void syntaxAnalyse();
     void objectCodeGenerate();
+    void setTracing(bool tracing);
+    void outputSymbolStack(ostream& out);
+    void outputStateStack(ostream& out);
 };
 
 
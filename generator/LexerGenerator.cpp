@@ -0,0 +1,493 @@
+#include "LexerGenerator.h"
+
+/**
+ * @brief Construct a new Lexer Generator object
+ */
+LexerGenerator::LexerGenerator() {
+	nfaStart = -1;
+	classCount = 0;
+}
+
+/**
+ * @brief read the token specification from file
+ * @param fileName: the name of the specification, every line is "TYPE ::= regex"
+ * @return true if the file is read successfully
+ */
+bool LexerGenerator::readSpecification(const char* fileName) {
+	ifstream fin;
+	fin.open(fileName, ios::in);
+	if (!fin.is_open()) {
+		cerr << "fail to open file " << fileName << endl;
+		return false;
+	}
+	char buf[1024];
+	while (fin >> buf) {
+		TokenRule rule;
+		// the left part is the name of the token type
+		rule.type = buf;
+		// there must be a "::=" in the middle
+		fin >> buf;
+		if (strcmp(buf, "::=") != 0) {
+			cerr << "expect ::= after " << rule.type << " in " << fileName << endl;
+			return false;
+		}
+		// the rest of the line is the regular expression
+		fin.getline(buf, 1024);
+		string regex = buf;
+		size_t first = regex.find_first_not_of(" \t\r");
+		size_t last = regex.find_last_not_of(" \t\r");
+		if (first == string::npos) {
+			cerr << "empty regular expression for " << rule.type << " in " << fileName << endl;
+			return false;
+		}
+		rule.regex = regex.substr(first, last - first + 1);
+		rules.push_back(rule);
+	}
+	fin.close();
+	return true;
+}
+
+/**
+ * @brief add a new state to the NFA
+ * @return int: index of the new state
+ */
+int LexerGenerator::newState() {
+	nfa.push_back(NFAState{ vector<pair<CharSet, int> >(), vector<int>(), -1 });
+	return (int)nfa.size() - 1;
+}
+
+/**
+ * @brief a NFA fragment which accepts one char of the set
+ * @param chars
+ * @return pair<int, int>: (start, end) of the fragment
+ */
+pair<int, int> LexerGenerator::charFragment(const CharSet& chars) {
+	int start = newState();
+	int end = newState();
+	nfa[start].edges.push_back(make_pair(chars, end));
+	return make_pair(start, end);
+}
+
+/**
+ * @brief parse an escaped or literal char
+ * @param re: the regular expression
+ * @param pos: the position of the char, moved after it
+ * @return char
+ */
+char LexerGenerator::parseChar(const string& re, size_t& pos) {
+	char c = re[pos++];
+	if (c != '\\') {
+		return c;
+	}
+	if (pos == re.size()) {
+		cerr << "regular expression " << re << " ends with \\" << endl;
+		exit(-1);
+	}
+	c = re[pos++];
+	switch (c) {
+		case 'n': return '\n';
+		case 't': return '\t';
+		case 'r': return '\r';
+		case 's': return ' ';
+		default: return c;
+	}
+}
+
+/**
+ * @brief parse a char class [...] or [^...], the '[' is already consumed
+ * @param re: the regular expression
+ * @param pos: the position after '[', moved after ']'
+ * @return CharSet
+ */
+CharSet LexerGenerator::parseClass(const string& re, size_t& pos) {
+	CharSet chars;
+	bool negate = false;
+	if (pos < re.size() && re[pos] == '^') {
+		negate = true;
+		pos++;
+	}
+	while (pos < re.size() && re[pos] != ']') {
+		unsigned char low = (unsigned char)parseChar(re, pos);
+		unsigned char high = low;
+		// a range like a-z
+		if (pos + 1 < re.size() && re[pos] == '-' && re[pos + 1] != ']') {
+			pos++;
+			high = (unsigned char)parseChar(re, pos);
+		}
+		for (int c = low; c <= high; c++) {
+			chars.set(c);
+		}
+	}
+	if (pos == re.size()) {
+		cerr << "unclosed [ in regular expression " << re << endl;
+		exit(-1);
+	}
+	pos++;
+	return negate ? ~chars : chars;
+}
+
+/**
+ * @brief atom ::= ( alternation ) | [ class ] | . | char
+ */
+pair<int, int> LexerGenerator::parseAtom(const string& re, size_t& pos) {
+	char c = re[pos];
+	if (c == '(') {
+		pos++;
+		pair<int, int> inner = parseAlternation(re, pos);
+		if (pos == re.size() || re[pos] != ')') {
+			cerr << "unclosed ( in regular expression " << re << endl;
+			exit(-1);
+		}
+		pos++;
+		return inner;
+	}
+	if (c == '[') {
+		pos++;
+		return charFragment(parseClass(re, pos));
+	}
+	if (c == '.') {
+		pos++;
+		CharSet chars;
+		chars.set();
+		chars.reset('\n');
+		return charFragment(chars);
+	}
+	CharSet chars;
+	chars.set((unsigned char)parseChar(re, pos));
+	return charFragment(chars);
+}
+
+/**
+ * @brief repetition ::= atom { * | + | ? }
+ */
+pair<int, int> LexerGenerator::parseRepetition(const string& re, size_t& pos) {
+	pair<int, int> frag = parseAtom(re, pos);
+	while (pos < re.size() && (re[pos] == '*' || re[pos] == '+' || re[pos] == '?')) {
+		char op = re[pos++];
+		int start = newState();
+		int end = newState();
+		nfa[start].epsilon.push_back(frag.first);
+		nfa[frag.second].epsilon.push_back(end);
+		// zero times
+		if (op == '*' || op == '?') {
+			nfa[start].epsilon.push_back(end);
+		}
+		// more times
+		if (op == '*' || op == '+') {
+			nfa[frag.second].epsilon.push_back(frag.first);
+		}
+		frag = make_pair(start, end);
+	}
+	return frag;
+}
+
+/**
+ * @brief concatenation ::= repetition { repetition }
+ */
+pair<int, int> LexerGenerator::parseConcatenation(const string& re, size_t& pos) {
+	int start = newState();
+	int end = start;
+	while (pos < re.size() && re[pos] != '|' && re[pos] != ')') {
+		pair<int, int> frag = parseRepetition(re, pos);
+		nfa[end].epsilon.push_back(frag.first);
+		end = frag.second;
+	}
+	return make_pair(start, end);
+}
+
+/**
+ * @brief alternation ::= concatenation { | concatenation }
+ */
+pair<int, int> LexerGenerator::parseAlternation(const string& re, size_t& pos) {
+	pair<int, int> frag = parseConcatenation(re, pos);
+	while (pos < re.size() && re[pos] == '|') {
+		pos++;
+		pair<int, int> other = parseConcatenation(re, pos);
+		int start = newState();
+		int end = newState();
+		nfa[start].epsilon.push_back(frag.first);
+		nfa[start].epsilon.push_back(other.first);
+		nfa[frag.second].epsilon.push_back(end);
+		nfa[other.second].epsilon.push_back(end);
+		frag = make_pair(start, end);
+	}
+	return frag;
+}
+
+/**
+ * @brief build the NFA of all rules, the start state has an empty transition to each rule
+ */
+void LexerGenerator::buildNFA() {
+	nfa.clear();
+	nfaStart = newState();
+	for (size_t i = 0; i < rules.size(); i++) {
+		size_t pos = 0;
+		pair<int, int> frag = parseAlternation(rules[i].regex, pos);
+		if (pos != rules[i].regex.size()) {
+			cerr << "unexpected " << rules[i].regex[pos] << " in regular expression " << rules[i].regex << endl;
+			exit(-1);
+		}
+		nfa[frag.second].accept = (int)i;
+		nfa[nfaStart].epsilon.push_back(frag.first);
+	}
+}
+
+/**
+ * @brief divide the 256 bytes into classes, the bytes in one class have the same transitions everywhere
+ */
+void LexerGenerator::buildCharClasses() {
+	// all different char sets used by the NFA
+	vector<CharSet> sets;
+	for (vector<NFAState>::iterator iter = nfa.begin(); iter != nfa.end(); iter++) {
+		for (vector<pair<CharSet, int> >::iterator eIter = iter->edges.begin(); eIter != iter->edges.end(); eIter++) {
+			if (find(sets.begin(), sets.end(), eIter->first) == sets.end()) {
+				sets.push_back(eIter->first);
+			}
+		}
+	}
+	// two bytes are in the same class if they belong to exactly the same sets
+	map<vector<bool>, int> signatureClass;
+	charClass.assign(256, 0);
+	for (int c = 0; c < 256; c++) {
+		vector<bool> signature;
+		for (vector<CharSet>::iterator sIter = sets.begin(); sIter != sets.end(); sIter++) {
+			signature.push_back(sIter->test(c));
+		}
+		map<vector<bool>, int>::iterator found = signatureClass.find(signature);
+		if (found == signatureClass.end()) {
+			int id = (int)signatureClass.size();
+			signatureClass[signature] = id;
+			charClass[c] = id;
+		}
+		else {
+			charClass[c] = found->second;
+		}
+	}
+	classCount = (int)signatureClass.size();
+}
+
+/**
+ * @brief the empty closure of a set of NFA states
+ * @param states
+ * @return set<int>
+ */
+set<int> LexerGenerator::closure(const set<int>& states) {
+	set<int> ret = states;
+	vector<int> worklist(states.begin(), states.end());
+	while (!worklist.empty()) {
+		int s = worklist.back();
+		worklist.pop_back();
+		for (vector<int>::iterator iter = nfa[s].epsilon.begin(); iter != nfa[s].epsilon.end(); iter++) {
+			if (ret.insert(*iter).second) {
+				worklist.push_back(*iter);
+			}
+		}
+	}
+	return ret;
+}
+
+/**
+ * @brief subset construction of the DFA over the char classes
+ */
+void LexerGenerator::buildDFA() {
+	// a representative byte of each class
+	vector<int> represent(classCount, -1);
+	for (int c = 255; c >= 0; c--) {
+		represent[charClass[c]] = c;
+	}
+	map<set<int>, int> stateIndex;
+	vector<set<int> > states;
+	// state 0 is the dead state, the empty set
+	states.push_back(set<int>());
+	stateIndex[set<int>()] = 0;
+	set<int> start;
+	start.insert(nfaStart);
+	states.push_back(closure(start));
+	stateIndex[states[1]] = 1;
+	dfa.clear();
+	dfaAccept.clear();
+	for (size_t i = 0; i < states.size(); i++) {
+		// the accepted rule is the first rule among the NFA states
+		int accept = -1;
+		for (set<int>::iterator iter = states[i].begin(); iter != states[i].end(); iter++) {
+			if (nfa[*iter].accept != -1 && (accept == -1 || nfa[*iter].accept < accept)) {
+				accept = nfa[*iter].accept;
+			}
+		}
+		dfaAccept.push_back(accept);
+		vector<int> row(classCount, 0);
+		for (int k = 0; k < classCount; k++) {
+			set<int> next;
+			for (set<int>::iterator iter = states[i].begin(); iter != states[i].end(); iter++) {
+				for (vector<pair<CharSet, int> >::iterator eIter = nfa[*iter].edges.begin(); eIter != nfa[*iter].edges.end(); eIter++) {
+					if (eIter->first.test(represent[k])) {
+						next.insert(eIter->second);
+					}
+				}
+			}
+			next = closure(next);
+			map<set<int>, int>::iterator found = stateIndex.find(next);
+			if (found == stateIndex.end()) {
+				stateIndex[next] = (int)states.size();
+				row[k] = (int)states.size();
+				states.push_back(next);
+			}
+			else {
+				row[k] = found->second;
+			}
+		}
+		dfa.push_back(row);
+	}
+}
+
+/**
+ * @brief minimize the DFA by refining the partition of states until it is stable (Moore's algorithm)
+ * @details states start in one block per accepted rule, a block is split when its states go to different blocks.
+ * 		The blocks are renumbered so that the dead state stays 0 and the start state stays 1.
+ */
+void LexerGenerator::minimize() {
+	int n = (int)dfa.size();
+	vector<int> block(n);
+	for (int i = 0; i < n; i++) {
+		block[i] = dfaAccept[i] + 1;
+	}
+	int blockCount = 0;
+	while (true) {
+		map<vector<int>, int> signatureBlock;
+		vector<int> newBlock(n);
+		for (int i = 0; i < n; i++) {
+			vector<int> signature;
+			signature.push_back(block[i]);
+			for (int k = 0; k < classCount; k++) {
+				signature.push_back(block[dfa[i][k]]);
+			}
+			map<vector<int>, int>::iterator found = signatureBlock.find(signature);
+			if (found == signatureBlock.end()) {
+				int id = (int)signatureBlock.size();
+				signatureBlock[signature] = id;
+				newBlock[i] = id;
+			}
+			else {
+				newBlock[i] = found->second;
+			}
+		}
+		block = newBlock;
+		if ((int)signatureBlock.size() == blockCount) {
+			break;
+		}
+		blockCount = (int)signatureBlock.size();
+	}
+
+	// renumber the blocks, dead state first, then in breadth first order from the start state
+	vector<int> order(blockCount, -1);
+	vector<int> represent;
+	order[block[0]] = 0;
+	represent.push_back(0);
+	if (order[block[1]] == -1) {
+		order[block[1]] = 1;
+		represent.push_back(1);
+	}
+	for (size_t i = 1; i < represent.size(); i++) {
+		for (int k = 0; k < classCount; k++) {
+			int next = dfa[represent[i]][k];
+			if (order[block[next]] == -1) {
+				order[block[next]] = (int)represent.size();
+				represent.push_back(next);
+			}
+		}
+	}
+	vector<vector<int> > minDFA;
+	vector<int> minAccept;
+	for (size_t i = 0; i < represent.size(); i++) {
+		vector<int> row(classCount);
+		for (int k = 0; k < classCount; k++) {
+			row[k] = order[block[dfa[represent[i]][k]]];
+		}
+		minDFA.push_back(row);
+		minAccept.push_back(dfaAccept[represent[i]]);
+	}
+	dfa = minDFA;
+	dfaAccept = minAccept;
+}
+
+/**
+ * @brief build the minimized DFA from the rules
+ */
+void LexerGenerator::generate() {
+	buildNFA();
+	buildCharClasses();
+	buildDFA();
+	minimize();
+}
+
+/**
+ * @brief output the tables as a C++ header
+ * @param fileName: the name of the header
+ * @param specName: the name of the specification, written in the header comment
+ * @return true if the header is written successfully
+ */
+bool LexerGenerator::outputTables(const char* fileName, const char* specName) {
+	ofstream fout;
+	fout.open(fileName, ios::out);
+	if (!fout.is_open()) {
+		cerr << "fail to open file " << fileName << endl;
+		return false;
+	}
+	int stateCount = (int)dfa.size();
+	const char* stateType = stateCount <= 256 ? "unsigned char" : "unsigned short";
+	fout << "// generated by lexgen from " << specName << ", do not edit" << endl;
+	fout << "// " << stateCount << " states, " << classCount << " char classes" << endl;
+	fout << "#ifndef LEXERTABLES_H" << endl;
+	fout << "#define LEXERTABLES_H" << endl;
+	fout << "#include \"Token.h\"" << endl << endl;
+	fout << "// state 0 is the dead state, scanning starts in state 1" << endl;
+	fout << "#define LEX_DEAD_STATE 0" << endl;
+	fout << "#define LEX_START_STATE 1" << endl;
+	fout << "#define LEX_STATE_COUNT " << stateCount << endl;
+	fout << "#define LEX_CLASS_COUNT " << classCount << endl << endl;
+	fout << "typedef " << stateType << " LexState;" << endl << endl;
+
+	fout << "// the char class of each byte" << endl;
+	fout << "static const unsigned char lexCharClass[256] = {";
+	for (int c = 0; c < 256; c++) {
+		fout << (c % 16 == 0 ? "\n\t" : " ") << charClass[c] << (c == 255 ? "" : ",");
+	}
+	fout << endl << "};" << endl << endl;
+
+	fout << "// lexTransition[state][class], the next state" << endl;
+	fout << "static const LexState lexTransition[LEX_STATE_COUNT][LEX_CLASS_COUNT] = {" << endl;
+	for (int s = 0; s < stateCount; s++) {
+		fout << "\t{";
+		for (int k = 0; k < classCount; k++) {
+			fout << (k ? ", " : " ") << dfa[s][k];
+		}
+		fout << " }" << (s + 1 == stateCount ? "" : ",") << endl;
+	}
+	fout << "};" << endl << endl;
+
+	fout << "// the token accepted in each state, ERROR if the state is not accepting" << endl;
+	fout << "static const TokenType lexAccept[LEX_STATE_COUNT] = {";
+	for (int s = 0; s < stateCount; s++) {
+		fout << (s % 8 == 0 ? "\n\t" : " ") << (dfaAccept[s] == -1 ? string("ERROR") : rules[dfaAccept[s]].type) << (s + 1 == stateCount ? "" : ",");
+	}
+	fout << endl << "};" << endl << endl;
+	fout << "#endif // !LEXERTABLES_H" << endl;
+	fout.close();
+	return true;
+}
+
+/**
+ * @brief get the number of states of the minimized DFA, including the dead state
+ * @return int
+ */
+int LexerGenerator::getStateCount() {
+	return (int)dfa.size();
+}
+
+/**
+ * @brief get the number of char classes
+ * @return int
+ */
+int LexerGenerator::getClassCount() {
+	return classCount;
+}
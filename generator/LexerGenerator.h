@@ -0,0 +1,68 @@
+#ifndef LEXERGENERATOR_H
+#define LEXERGENERATOR_H
+#include "../utils.h"
+#include <bitset>
+
+/**
+ * @file LexerGenerator.h
+ * @brief compile the token specification (tokens.txt) into the DFA tables used by LexicalAnalyser
+ * @author chtholly
+ * @details every line of the specification is "TYPE ::= regex", read the same way as productions.txt.
+ * 		TYPE is the name of a TokenType, earlier rules win when two rules match the same longest lexeme.
+ * 		The regular expressions support literal chars, \ escapes, [...] and [^...] classes, ., |, *, + and ?.
+ */
+
+// a set of input bytes
+typedef bitset<256> CharSet;
+
+// a rule of the token specification
+struct TokenRule {
+	string type;				// the name of the TokenType
+	string regex;				// the regular expression
+};
+
+// a state of the NFA
+struct NFAState {
+	vector<pair<CharSet, int> > edges;	// transitions on a set of chars
+	vector<int> epsilon;				// empty transitions
+	int accept;							// the rule accepted in this state, -1 for none
+};
+
+/**
+ * @brief lexer generator, build NFA from the rules, then a DFA over character classes, then minimize it
+ */
+class LexerGenerator {
+private:
+	vector<TokenRule> rules;		// all rules of the specification
+	vector<NFAState> nfa;			// Thompson NFA of all rules
+	int nfaStart;					// start state of the NFA
+	vector<int> charClass;			// equivalence class of each byte
+	int classCount;					// number of equivalence classes
+	vector<vector<int> > dfa;		// DFA transitions, dfa[state][class], 0 is the dead state and 1 the start state
+	vector<int> dfaAccept;			// the rule accepted in each DFA state, -1 for none
+
+	// regular expression parser, return the (start, end) fragment of the NFA
+	int newState();
+	pair<int, int> parseAlternation(const string& re, size_t& pos);
+	pair<int, int> parseConcatenation(const string& re, size_t& pos);
+	pair<int, int> parseRepetition(const string& re, size_t& pos);
+	pair<int, int> parseAtom(const string& re, size_t& pos);
+	CharSet parseClass(const string& re, size_t& pos);
+	char parseChar(const string& re, size_t& pos);
+	pair<int, int> charFragment(const CharSet& chars);
+
+	set<int> closure(const set<int>& states);
+	void buildNFA();
+	void buildCharClasses();
+	void buildDFA();
+	void minimize();
+public:
+	LexerGenerator();
+	bool readSpecification(const char* fileName);
+	void generate();
+	bool outputTables(const char* fileName, const char* specName);
+	int getStateCount();
+	int getClassCount();
+};
+
+#endif // !LEXERGENERATOR_H
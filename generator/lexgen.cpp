@@ -0,0 +1,23 @@
+#include "LexerGenerator.h"
+
+/**
+ * @file lexgen.cpp
+ * @brief build step: compile the token specification into LexerTables.h
+ * @details usage: lexgen tokens.txt LexerTables.h
+ */
+int main(int argc, char* argv[]) {
+	if (argc != 3) {
+		cerr << "usage: lexgen <token specification> <output header>" << endl;
+		return 1;
+	}
+	LexerGenerator generator;
+	if (!generator.readSpecification(argv[1])) {
+		return 1;
+	}
+	generator.generate();
+	if (!generator.outputTables(argv[2], argv[1])) {
+		return 1;
+	}
+	cout << "lexgen: " << generator.getStateCount() << " states, " << generator.getClassCount() << " char classes" << endl;
+	return 0;
+}
@@ -0,0 +1,23 @@
+#include "../table.h"
+
+/**
+ * @file parsegen.cpp
+ * @brief build step: build the LR(1) tables of the grammar into ParserTables.h
+ * @details usage: parsegen productions.txt ParserTables.h
+ */
+int main(int argc, char* argv[]) {
+	if (argc != 3) {
+		cerr << "usage: parsegen <grammar> <output header>" << endl;
+		return 1;
+	}
+	AnalyseTable table(argv[1], false);
+	if (errorMessage != "") {
+		cerr << "parsegen: " << errorMessage << endl;
+		return 1;
+	}
+	if (!table.outputTables(argv[2], argv[1])) {
+		return 1;
+	}
+	cout << "parsegen: tables of " << argv[1] << " written into " << argv[2] << endl;
+	return 0;
+}
@@ -1,4 +1,11 @@
 #include "table.h"
+#include "ParserTables.h"
+#include "TerminalTable.h"
+#include "ThreadPool.h"
+#include <memory>
+#include <chrono>
+
+int AnalyseTable::buildThreads = 0;
 
 /**
  * @brief reload operator < for Item
@@ -26,6 +33,8 @@ bool operator ==(const Item&one, const Item& other) {
 
 /**
  * @brief read productions from file
+ * @details a line "%left a b" or "%right a b" gives the terminals a and b a precedence, higher than the lines
+ * 		before it, and an associativity, see getLookaheads.
  * @param fileName the name of the production
  */
 void AnalyseTable::readProductions(const char*fileName) {
@@ -39,7 +48,28 @@ void AnalyseTable::readProductions(const char*fileName) {
 	// read productions
 	int index = 0;			// production id
 	char buf[1024];			// char buffer
+	int level = 0;			// precedence of the last declaration
 	while (fin >> buf) {
+		// a precedence declaration
+		if (buf[0] == '%') {
+			string declaration = buf;
+			fin.getline(buf, 1024);
+			if (declaration != "%left" && declaration != "%right") {
+				outputError("unknown declaration " + declaration + " in " + string(fileName));
+				continue;
+			}
+			level++;
+			stringstream sstream(buf);
+			string temp;
+			while (sstream >> temp) {
+				if (!isVT(temp)) {
+					outputError("precedence of " + temp + ", which is not a terminal");
+					continue;
+				}
+				precedence[Symbol{ true,temp }] = Precedence{ level, declaration == "%left" ? Associativity::Left : Associativity::Right };
+			}
+			continue;
+		}
 		Production p;
 		// assign production id
 		p.id = index++;		
@@ -68,273 +98,1053 @@ void AnalyseTable::readProductions(const char*fileName) {
 
 
 /**
- * @brief get the first set of each symbol
+ * @brief the digraph algorithm of DeRemer and Pennello
+ * @details makes each set the union of its own and the sets of every node it reaches through the relation,
+ * 		walking each edge once; the nodes of a strongly connected component all get the same set.
+ * @param relation: the nodes each node is related to
+ * @param sets: the sets of the nodes, replaced by the unions
  */
-void AnalyseTable::getFirst() {
-	// if there are any change in the first set of each symbol
-	bool updateFlag = true;
-	// loop until the first set of each symbol does not change
-	while (updateFlag) {
-		updateFlag = false;
-		//tranverse each production
-		for (vector<Production>::iterator iter = productions.begin(); iter != productions.end(); iter++) {
-			vector<Symbol>::iterator symbolIter;
-			//tranverse each symbol in the right part of the production
-			for (symbolIter = iter->right.begin(); symbolIter != iter->right.end(); symbolIter++) {
-				//this symbol is a terminal symbol, add it to the first set of the left symbol
-				if (symbolIter->isVt) {
-					// if the first set of the left symbol has not initialed
-					if (first.count(iter->left) == 0) {
-						first[iter->left] = set<Symbol>();
-					}
-					// if the first set of the left symbol does not contain this terminal symbol
-					if (first[iter->left].insert(*symbolIter).second == true) {
-						updateFlag = true;
-					}
-					break;
-				}
-				// this symbol is a non-terminal symbol
-				// if we need to consider the first set of the next symbol
-				bool continueFlag = false;
-				//tranverse the first set of the symbol
-				for (set<Symbol>::iterator firstIter = first[*symbolIter].begin(); firstIter != first[*symbolIter].end(); firstIter++) {
-					//if the first set of the symbol contains EMPTY, we need to consider first set of next symbol
-					if (firstIter->content == "EMPTY") {
-						continueFlag = true;
-					}
-					//if current symbol is not in the first set of the left symbol, add it to the first set of the left symbol
-					else if (first[iter->left].find(*firstIter) == first[iter->left].end()) {
-						if (first.count(iter->left) == 0) {
-							first[iter->left] = set<Symbol>();
-						}
-						first[iter->left].insert(*firstIter);
-						updateFlag = true;
-					}
-				}
-				// if the first set of the symbol does not contain EMPTY, we do not need to consider the first set of the next symbol
-				if (!continueFlag) {
+static void digraph(const vector<vector<int> >& relation, vector<TerminalSet>& sets) {
+	const int done = INT32_MAX;
+	vector<int> depth(relation.size(), 0);
+	vector<int> nodes;
+	function<void(int)> traverse = [&](int x) {
+		nodes.push_back(x);
+		int d = (int)nodes.size();
+		depth[x] = d;
+		for (size_t i = 0; i < relation[x].size(); i++) {
+			int y = relation[x][i];
+			if (depth[y] == 0) {
+				traverse(y);
+			}
+			depth[x] = min(depth[x], depth[y]);
+			sets[x].unite(sets[y]);
+		}
+		// x is the root of a strongly connected component, which is on the stack above it
+		if (depth[x] == d) {
+			while (true) {
+				int top = nodes.back();
+				nodes.pop_back();
+				depth[top] = done;
+				if (top == x) {
 					break;
 				}
+				sets[top] = sets[x];
 			}
-			// EMPTY is contained in the first set of all symbols in the right part of the production
-			// then add EMPTY to the first set of the left symbol
-			if (symbolIter == iter->right.end()) {
-				if (first.count(iter->left) == 0) {
-					first[iter->left] = set<Symbol>();
-				}
-				if (first[iter->left].insert(Symbol{ true,"EMPTY" }).second == true) {
-					updateFlag = true;
-				}
+		}
+	};
+	for (size_t x = 0; x < relation.size(); x++) {
+		if (depth[x] == 0) {
+			traverse((int)x);
+		}
+	}
+}
+
+/**
+ * @brief if a symbol of the grammar derives EMPTY
+ */
+bool AnalyseTable::isNullable(const Symbol& symbol) const {
+	return !symbol.isVt && symbol.id >= terminalCount && nullable[symbol.id - terminalCount];
+}
+
+/**
+ * @brief get the first set of each non-terminal, and which ones derive EMPTY
+ * @details a non-terminal derives EMPTY once every symbol of one of its productions does, which is found with
+ * 		a count of the symbols not known to derive EMPTY in each production.
+ * 		Then FIRST(A) is the terminals starting a production of A after non-terminals deriving EMPTY,
+ * 		united through the relation A -> B for each such B, with the digraph algorithm.
+ * 		An undefined non-terminal has no id, it derives nothing.
+ */
+void AnalyseTable::getFirst() {
+	int nonTerminalCount = (int)symbols.size() - terminalCount;
+	nullable.assign(nonTerminalCount, false);
+	// the productions each non-terminal appears in, and the number of symbols not known to derive EMPTY
+	vector<vector<int> > occurrences(nonTerminalCount);
+	vector<int> remaining(productions.size());
+	vector<int> pending;
+	for (size_t i = 0; i < productions.size(); i++) {
+		const vector<Symbol>& right = productions[i].right;
+		remaining[i] = (int)right.size();
+		for (size_t j = 0; j < right.size(); j++) {
+			if (right[j].isVt || right[j].id < 0) {
+				// it can never derive EMPTY
+				remaining[i] = -1;
+				break;
+			}
+		}
+		if (remaining[i] > 0) {
+			for (size_t j = 0; j < right.size(); j++) {
+				occurrences[right[j].id - terminalCount].push_back((int)i);
+			}
+		}
+		if (remaining[i] == 0 && !nullable[productions[i].left.id - terminalCount]) {
+			nullable[productions[i].left.id - terminalCount] = true;
+			pending.push_back(productions[i].left.id - terminalCount);
+		}
+	}
+	while (!pending.empty()) {
+		int n = pending.back();
+		pending.pop_back();
+		for (size_t k = 0; k < occurrences[n].size(); k++) {
+			int pro = occurrences[n][k];
+			int left = productions[pro].left.id - terminalCount;
+			if (--remaining[pro] == 0 && !nullable[left]) {
+				nullable[left] = true;
+				pending.push_back(left);
 			}
 		}
+	}
 
+	first.assign(nonTerminalCount, TerminalSet(terminalCount));
+	vector<vector<int> > relation(nonTerminalCount);
+	for (size_t i = 0; i < productions.size(); i++) {
+		int left = productions[i].left.id - terminalCount;
+		const vector<Symbol>& right = productions[i].right;
+		for (size_t j = 0; j < right.size() && right[j].id >= 0; j++) {
+			if (right[j].isVt) {
+				first[left].insert(right[j].id);
+				break;
+			}
+			relation[left].push_back(right[j].id - terminalCount);
+			if (!isNullable(right[j])) {
+				break;
+			}
+		}
 	}
+	digraph(relation, first);
 }
 
 /**
- * @brief get the follow set of each non-terminal symbol
+ * @brief get the follow set of each non-terminal
+ * @details for each B in A ::= x B y, FOLLOW(B) has FIRST(y), and is united with FOLLOW(A) when y derives EMPTY,
+ * 		through the relation B -> A with the digraph algorithm. # follows the start symbol.
  */
 void AnalyseTable::getFollow() {
+	int nonTerminalCount = (int)symbols.size() - terminalCount;
+	follow.assign(nonTerminalCount, TerminalSet(terminalCount));
 	// add # to the follow set of the start symbol
-	follow[productions[0].left] = set<Symbol>();
-	follow[productions[0].left].insert(Symbol{ true,"#" });
-	// if there are any change in the follow set of each non-terminal symbol
-	bool updateFlag = true;
-	// tranverse until the follow set of each non-terminal symbol does not change
-	while (updateFlag) {
-		updateFlag = false;
-		// tranverse each production
-		for (vector<Production>::iterator proIter = productions.begin(); proIter != productions.end(); proIter++) {
-			// tranverse each symbol in the right part of the production
-			for (vector<Symbol>::iterator symbolIter = proIter->right.begin(); symbolIter != proIter->right.end(); symbolIter++) {
-				// tranverse the symbol after the current symbol
-				vector<Symbol>::iterator nextsymbolIter;
-				for (nextsymbolIter = symbolIter + 1; nextsymbolIter != proIter->right.end(); nextsymbolIter++) {
-					Symbol nextSym = *nextsymbolIter;
-					// if the next symbol is a terminal symbol, add it to the follow set of the current symbol
-					if (nextSym.isVt) {
-						if (follow.count(*symbolIter) == 0) {
-							follow[*symbolIter] = set<Symbol>();
-						}
-						// if there is update in the follow set of the current symbol
-						// which means that the follow set of the current symbol does not contain this terminal symbol before this iteration
-						if (follow[*symbolIter].insert(nextSym).second == true) {
-							updateFlag = true;
-						}
-						break;
-					}
-					// the next symbol is a non-terminal symbol
-					// tranverse the first set of the next symbol
-					bool continueFlag = false;
-					for (set<Symbol>::iterator fIter = first[nextSym].begin(); fIter != first[nextSym].end(); fIter++) {
-						// if the first set of the next symbol contains EMPTY, we need to consider the first set of the next symbol
-						if (fIter->content == "EMPTY") {
-							continueFlag = true;
-						}
-						else {
-							// add the symbol in the first set of the next symbol to the follow set of the current symbol
-							if (follow.count(*symbolIter) == 0) {
-								follow[*symbolIter] = set<Symbol>();
-							}
-							// if there is update in the follow set of the current symbol
-							if (follow[*symbolIter].insert(*fIter).second == true) {
-								updateFlag = true;
-							}
-						}
-					}
-					// if the first set of the next symbol does not contain EMPTY, we do not need to consider the first set of the next symbol
-					if (!continueFlag) {
-						break;
-					}
-
+	follow[productions[0].left.id - terminalCount].insert(ENDFILE);
+	vector<vector<int> > relation(nonTerminalCount);
+	for (size_t i = 0; i < productions.size(); i++) {
+		const vector<Symbol>& right = productions[i].right;
+		for (size_t j = 0; j < right.size(); j++) {
+			if (right[j].isVt || right[j].id < 0) {
+				continue;
+			}
+			TerminalSet& current = follow[right[j].id - terminalCount];
+			// the symbols after the current one, until one does not derive EMPTY
+			size_t k = j + 1;
+			for (; k < right.size(); k++) {
+				if (right[k].id < 0) {
+					break;
 				}
-				// if EMPTY is in the first set of all symbols after the current symbol
-				if (nextsymbolIter == proIter->right.end()) {
-					// add the follow set of the left symbol of the production to the follow set of the current symbol
-					for (set<Symbol>::iterator followIter = follow[proIter->left].begin(); followIter != follow[proIter->left].end(); followIter++) {
-						if (follow.count(*symbolIter) == 0) {
-							follow[*symbolIter] = set<Symbol>();
-						}
-						// update flag
-						if (follow[*symbolIter].insert(*followIter).second == true) {
-							updateFlag = true;
-						}
-					}
+				if (right[k].isVt) {
+					current.insert(right[k].id);
+					break;
 				}
+				current.unite(first[right[k].id - terminalCount]);
+				if (!isNullable(right[k])) {
+					break;
+				}
+			}
+			// EMPTY is derived by all symbols after the current one
+			if (k == right.size()) {
+				relation[right[j].id - terminalCount].push_back(productions[i].left.id - terminalCount);
 			}
 		}
 	}
+	digraph(relation, follow);
 }
 
 /**
- * @brief derive the closure of a item
- * @details derive the closure recursively
- * @param item 
- * @return status 
+ * @brief hash of a kernel, the items of a status which are not derived
  */
-status AnalyseTable::derive(Item item) {
-	status i;
-	// insert this item into the closure
-	i.insert(item);
-	// if the symbol after the point is a non-terminal symbol and the point is not at the end of the production
-	// then add the productions whose left part is the symbol after the point to the closure
-	if(	productions[item.pro].right.size() != item.pointPos &&
-		productions[item.pro].right[item.pointPos].isVt == false){
-		// tranverse all productions
-		vector<Production>::iterator iter;
-		for (iter = productions.begin(); iter < productions.end(); iter++) {
-			// if the left part of the production is the symbol after the point
-			if (iter->left == productions[item.pro].right[item.pointPos]) {
-				// union the closure of this item to the closure of the parameter item
-				status temp = derive(Item{ int(iter - productions.begin()),0 });
-				set<Item>::iterator siter;
-				for (siter = temp.begin(); siter != temp.end(); siter++) {
-					i.insert(*siter);
+size_t KernelHash::operator()(const vector<Item>& kernel) const {
+	size_t h = kernel.size();
+	for (size_t i = 0; i < kernel.size(); i++) {
+		h = h * 1000003 ^ (size_t)(kernel[i].pro * 64 + kernel[i].pointPos);
+	}
+	return h;
+}
+
+/**
+ * @brief compute the productions derived from each non-terminal
+ * @details closures[A] holds every production p such that the item (p, 0) is in the closure of an item
+ * 		with the point before A, in the order the old recursive derivation found them.
+ * 		A non-terminal is visited once per closure, so left recursion stops.
+ */
+void AnalyseTable::getClosures() {
+	int nonTerminalCount = (int)symbols.size() - terminalCount;
+	// the productions of each non-terminal
+	vector<vector<int> > alternatives(nonTerminalCount);
+	for (size_t i = 0; i < productions.size(); i++) {
+		alternatives[productions[i].left.id - terminalCount].push_back((int)i);
+	}
+	closures.assign(nonTerminalCount, vector<int>());
+	for (int n = 0; n < nonTerminalCount; n++) {
+		vector<int>& derived = closures[n];
+		vector<bool> visited(nonTerminalCount, false);
+		vector<int> pending(1, n);
+		visited[n] = true;
+		while (!pending.empty()) {
+			int symbol = pending.back();
+			pending.pop_back();
+			for (size_t k = 0; k < alternatives[symbol].size(); k++) {
+				int j = alternatives[symbol][k];
+				derived.push_back(j);
+				const vector<Symbol>& right = productions[j].right;
+				if (!right.empty() && right[0].isVt == false && right[0].id >= 0 && !visited[right[0].id - terminalCount]) {
+					visited[right[0].id - terminalCount] = true;
+					pending.push_back(right[0].id - terminalCount);
 				}
 			}
 		}
 	}
+}
 
+/**
+ * @brief derive the closure of a kernel
+ * @details the closures of the non-terminals are precomputed, so one pass over the kernel is enough.
+ * 		It only reads the table, several threads may derive at once.
+ * @param kernel
+ * @return status
+ */
+status AnalyseTable::derive(const vector<Item>& kernel) const {
+	status i(kernel.begin(), kernel.end());
+	for (size_t k = 0; k < kernel.size(); k++) {
+		const Production& production = productions[kernel[k].pro];
+		// if the symbol after the point is a non-terminal symbol, add the items of the productions it derives
+		if ((int)production.right.size() != kernel[k].pointPos && production.right[kernel[k].pointPos].isVt == false
+			&& production.right[kernel[k].pointPos].id >= 0) {
+			const vector<int>& derived = closures[production.right[kernel[k].pointPos].id - terminalCount];
+			for (size_t d = 0; d < derived.size(); d++) {
+				i.insert(Item{ derived[d], 0 });
+			}
+		}
+	}
 	return i;
 }
 
+// a part of the hash table of kernels, with its own lock
+struct KernelShard {
+	mutex lock;
+	unordered_map<vector<Item>, int, KernelHash> ids;
+};
+
 /**
- * @brief create DFA and LR1 table
+ * @brief create the LR(0) DFA and the shifts of the LR1 table
+ * @details the DFA grows breadth first. The statuses of a frontier are closed, and the kernels of their gotos
+ * 		looked up in a hash table split into locked shards, by the threads of a pool; a kernel seen for the first
+ * 		time becomes a status of the next frontier. A small frontier is done by the calling thread.
+ * 		The statuses are numbered in the order the threads found them, so at the end they are numbered again in
+ * 		the order of a serial build: from the start status, each status in turn numbers the new targets of its
+ * 		gotos in the order their symbols first follow a point in its items.
  */
 void AnalyseTable::createDFA() {
-	// index of the status in the DFA
+	getClosures();
+	const size_t shardCount = 64;
+	vector<KernelShard> shards(shardCount);
+	KernelHash hasher;
+	unique_ptr<ThreadPool> pool;
+	// by the number given when the kernel was found: the kernel, the status and its gotos in order
+	vector<vector<Item> > kernels(1, vector<Item>(1, Item{ 0,0 }));
+	vector<status> stas;
+	vector<vector<pair<Symbol, int> > > transfers;
+	atomic<int> found(1);
+	shards[hasher(kernels[0]) % shardCount].ids[kernels[0]] = 0;
+
+	int frontierBegin = 0;
+	int frontierEnd = 1;
+	while (frontierBegin < frontierEnd) {
+		stas.resize(frontierEnd);
+		transfers.resize(frontierEnd);
+		// the kernels found by each status of the frontier
+		vector<vector<pair<int, vector<Item> > > > created(frontierEnd - frontierBegin);
+		function<void(size_t)> expand = [&](size_t k) {
+			int s = frontierBegin + (int)k;
+			stas[s] = derive(kernels[s]);
+			// the kernel of the goto on each symbol after a point, in the order the symbols appear
+			vector<Symbol> order;
+			map<Symbol, vector<Item> > gotoKernels;
+			for (set<Item>::iterator itIter = stas[s].begin(); itIter != stas[s].end(); itIter++) {
+				if ((int)productions[itIter->pro].right.size() != itIter->pointPos) {
+					const Symbol& nextSymbol = productions[itIter->pro].right[itIter->pointPos];
+					vector<Item>& kernel = gotoKernels[nextSymbol];
+					if (kernel.empty()) {
+						order.push_back(nextSymbol);
+					}
+					kernel.push_back(Item{ itIter->pro,itIter->pointPos + 1 });
+				}
+			}
+			for (size_t i = 0; i < order.size(); i++) {
+				vector<Item>& kernel = gotoKernels[order[i]];
+				KernelShard& shard = shards[hasher(kernel) % shardCount];
+				int index;
+				bool isNew = false;
+				{
+					lock_guard<mutex> guard(shard.lock);
+					unordered_map<vector<Item>, int, KernelHash>::iterator iter = shard.ids.find(kernel);
+					if (iter != shard.ids.end()) {
+						index = iter->second;
+					}
+					else {
+						index = found++;
+						shard.ids[kernel] = index;
+						isNew = true;
+					}
+				}
+				if (isNew) {
+					created[k].push_back(make_pair(index, kernel));
+				}
+				transfers[s].push_back(make_pair(order[i], index));
+			}
+		};
+		if (frontierEnd - frontierBegin >= PARALLEL_DFA_MIN_FRONTIER && !pool && buildThreads != 1) {
+			pool.reset(new ThreadPool(buildThreads));
+		}
+		if (pool && frontierEnd - frontierBegin >= PARALLEL_DFA_MIN_FRONTIER) {
+			pool->run(frontierEnd - frontierBegin, expand);
+		}
+		else {
+			for (int k = 0; k < frontierEnd - frontierBegin; k++) {
+				expand(k);
+			}
+		}
+		kernels.resize(found);
+		for (size_t k = 0; k < created.size(); k++) {
+			for (size_t i = 0; i < created[k].size(); i++) {
+				kernels[created[k][i].first].swap(created[k][i].second);
+			}
+		}
+		frontierBegin = frontierEnd;
+		frontierEnd = found;
+	}
+	pool.reset();
+	shards.clear();
+	kernels.clear();
+
+	// number the statuses as the serial build does
+	vector<int> number(stas.size(), -1);
+	vector<int> order(1, 0);
+	number[0] = 0;
+	for (size_t i = 0; i < order.size(); i++) {
+		const vector<pair<Symbol, int> >& gotos = transfers[order[i]];
+		for (size_t j = 0; j < gotos.size(); j++) {
+			if (number[gotos[j].second] == -1) {
+				number[gotos[j].second] = (int)order.size();
+				order.push_back(gotos[j].second);
+			}
+		}
+	}
+	for (size_t i = 0; i < order.size(); i++) {
+		dfa.stas.push_back(status());
+		dfa.stas.back().swap(stas[order[i]]);
+		const vector<pair<Symbol, int> >& gotos = transfers[order[i]];
+		for (size_t j = 0; j < gotos.size(); j++) {
+			GOTO key((int)i, gotos[j].first);
+			// add a new transfer, from i to the number of its target, with the symbol
+			dfa.goTo[key] = number[gotos[j].second];
+			// shift behavior
+			LR1_Table[key] = Behavior{ shift,number[gotos[j].second] };
+		}
+	}
+	closures.clear();
+}
+
+/**
+ * @brief construct analyse table from product.txt
+ * @details if the grammar is the one parsegen compiled into ParserTables.h, the tables are taken from there.
+ * 		Otherwise they are loaded from the cache next to the grammar file if it was made from the same grammar,
+ * 		or they are built and the cache is written again. A grammar with conflicts is never cached,
+ * 		so the errors are reported every time.
+ * @param fileName 
+ * @param reuse: false to always build the tables from the grammar, without the generated tables and the cache
+ * @param lookahead: how the reductions are computed, the generated tables and the cache are only used for LALR(1)
+ * @param construction: StateConstruction::Lazy builds the states while the parser reaches them, it implies
+ * 		LookaheadMode::SLR whatever lookahead is, and never uses the generated tables and the cache
+ */
+AnalyseTable::AnalyseTable(const char*fileName, bool reuse, LookaheadMode lookahead, StateConstruction construction) {
+	// the LALR(1) lookaheads of a state depend on the whole DFA, a lazy table has only the states reached
+	if (construction == StateConstruction::Lazy) {
+		lookahead = LookaheadMode::SLR;
+	}
+	this->lookahead = lookahead;
+	// the generated tables and the cache are LALR(1)
+	reuse = reuse && lookahead == LookaheadMode::LALR;
+	terminalCount = 0;
+	stateCount = 0;
+	itemCount = 0;
+	builtCount = 0;
+	buildTimes = TableBuildTimes{ 0,0,0,0,0 };
+	actions = nullptr;
+	gotos = nullptr;
+	itemStart = nullptr;
+	items = nullptr;
+	backend = TableBackend::Dense;
+	string cacheName = string(fileName) + TABLE_CACHE_SUFFIX;
+	uint64_t hash = grammarHash(fileName);
+	generated = reuse && hash != 0 && hash == PARSE_GRAMMAR_HASH;
+	if (generated) {
+		loadGenerated();
+		rebuilt = false;
+		return;
+	}
+	rebuilt = !reuse || !loadCache(cacheName.c_str(), hash);
+	if (!rebuilt) {
+		return;
+	}
+	string oldError = errorMessage;
+	// the time since the last step, the steps are cheap next to the clock
+	chrono::steady_clock::time_point last = chrono::steady_clock::now();
+	auto lap = [&last]() {
+		chrono::steady_clock::time_point now = chrono::steady_clock::now();
+		chrono::duration<double> elapsed = now - last;
+		last = now;
+		return elapsed.count();
+	};
+	readProductions(fileName);
+	numberSymbols();
+	buildTimes.read = lap();
+	getFirst();
+	getFollow();
+	buildTimes.firstFollow = lap();
+	if (construction == StateConstruction::Lazy) {
+		getClosures();
+		getPrecedences();
+		findState(vector<Item>(1, Item{ 0,0 }));
+		buildTimes.automaton = lap();
+		return;
+	}
+	createDFA();
+	buildTimes.automaton = lap();
+	getLookaheads();
+	buildTimes.lookaheads = lap();
+	packTables();
+	buildTimes.pack = lap();
+	if (reuse && errorMessage == oldError) {
+		saveCache(cacheName.c_str(), hash);
+	}
+}
+
+/**
+ * @brief add the reductions to the LR1 table
+ * @details with LookaheadMode::SLR a production reduces on the FOLLOW set of its left symbol.
+ * 		With LookaheadMode::LALR the lookaheads are the ones of DeRemer and Pennello, on the transitions on
+ * 		non-terminals of the LR(0) DFA:
+ * 		DR(p, A) are the terminals shifted after it, and # after the start symbol from the start status;
+ * 		(p, A) reads (r, C) if r = GOTO(p, A) and C derives EMPTY, Read is DR through reads;
+ * 		(p, A) includes (p', B) if B ::= x A y, y derives EMPTY and p' goes to p on x, Follow is Read through includes;
+ * 		a reduction of A ::= w in q looks back to each (p, A) such that p goes to q on w, and its lookaheads
+ * 		are the union of their Follow sets.
+ * 		A shift and a reduction on a terminal with a precedence, by a production with one, are resolved as yacc does:
+ * 		the higher precedence wins, and on the same one a left associative terminal reduces and a right one shifts.
+ * 		Another conflict is reported, the shift or the production written first is kept.
+ */
+void AnalyseTable::getLookaheads() {
+	// the reductions of each status, each is a production and its lookaheads
+	vector<vector<pair<int, TerminalSet> > > reductions(dfa.stas.size());
 	int nowI = 0;
-	// add the closure of the first production to the DFA
-	dfa.stas.push_back(derive(Item{ 0,0 }));
-	// tranverse each status in the DFA
 	for (list<status>::iterator iter = dfa.stas.begin(); iter != dfa.stas.end(); iter++, nowI++) {
-		// tranverse each item in the status
 		for (set<Item>::iterator itIter = iter->begin(); itIter != iter->end(); itIter++) {
-			// this is a reduct item
-			if (productions[itIter->pro].right.size() == itIter->pointPos) {
-				set<Symbol>FOLLOW = follow[productions[itIter->pro].left];
-				// tranverse each symbol in the follow set of the left symbol of the production
-				for (set<Symbol>::iterator followIter = FOLLOW.begin(); followIter != FOLLOW.end(); followIter++) {
-					// exist conflict in LR1 table
-					if (LR1_Table.count(GOTO(nowI, *followIter)) == 1) {
-						string err = "is not LR(1) grammar, exist conflict in GOTO( ";
-						outputError(err);
-					}
-					// if it is the reduction of the start symbol, then it is accept
-					// otherwise it is reduct
-					LR1_Table[GOTO(nowI, *followIter)] = Behavior{ (itIter->pro == 0) ? accept : reduct,itIter->pro };
+			if ((int)productions[itIter->pro].right.size() == itIter->pointPos) {
+				reductions[nowI].push_back(make_pair(itIter->pro, TerminalSet(terminalCount)));
+			}
+		}
+	}
 
-				}
-				continue;
+	if (lookahead == LookaheadMode::SLR) {
+		for (size_t q = 0; q < reductions.size(); q++) {
+			for (size_t r = 0; r < reductions[q].size(); r++) {
+				reductions[q][r].second = follow[productions[reductions[q][r].first].left.id - terminalCount];
+			}
+		}
+	}
+	else {
+		// the status p goes to on x, -1 if it has no transfer
+		auto walk = [&](int p, const Symbol& x) {
+			map<GOTO, int>::iterator found = dfa.goTo.find(GOTO(p, x));
+			return found == dfa.goTo.end() ? -1 : found->second;
+		};
+		// the transfers on non-terminals, and the one from the start status on the start symbol
+		const Symbol& start = productions[0].left;
+		map<GOTO, int> transitions;
+		vector<GOTO> nodes;
+		for (map<GOTO, int>::iterator iter = dfa.goTo.begin(); iter != dfa.goTo.end(); iter++) {
+			if (!iter->first.second.isVt) {
+				transitions[iter->first] = (int)nodes.size();
+				nodes.push_back(iter->first);
 			}
-			// this is a shift item
-			// the symbol after the point
-			Symbol nextSymbol = productions[itIter->pro].right[itIter->pointPos];
+		}
+		if (transitions.count(GOTO(0, start)) == 0) {
+			transitions[GOTO(0, start)] = (int)nodes.size();
+			nodes.push_back(GOTO(0, start));
+		}
 
-			// if there is already a GOTO[nowI,nextSymbol], then continue
-			if (dfa.goTo.count(GOTO(nowI, nextSymbol)) == 1) {
+		// DR and reads
+		vector<TerminalSet> sets(nodes.size(), TerminalSet(terminalCount));
+		vector<vector<int> > relation(nodes.size());
+		for (size_t x = 0; x < nodes.size(); x++) {
+			if (nodes[x].first == 0 && nodes[x].second == start) {
+				sets[x].insert(ENDFILE);
+			}
+			int r = walk(nodes[x].first, nodes[x].second);
+			if (r == -1) {
 				continue;
 			}
+			for (map<GOTO, int>::iterator iter = dfa.goTo.lower_bound(GOTO(r, Symbol())); iter != dfa.goTo.end() && iter->first.first == r; iter++) {
+				if (iter->first.second.isVt) {
+					sets[x].insert(iter->first.second.id);
+				}
+				else if (isNullable(iter->first.second)) {
+					relation[x].push_back(transitions[iter->first]);
+				}
+			}
+		}
+		digraph(relation, sets);
 
-			// otherwise ,create a new DFA status, derive the closure of the corresponding item
-			status newI = derive(Item{ itIter->pro,itIter->pointPos + 1 });
-			// tranverse each item except the current item in the status
-			set<Item>::iterator shiftIter = itIter;
-			shiftIter++;
-			for (; shiftIter != iter->end(); shiftIter++) {
-				// ignore the reduct item
-				if (productions[shiftIter->pro].right.size() == shiftIter->pointPos) {
+		// includes and lookback, found by walking each production from each transfer on its left symbol
+		for (size_t x = 0; x < nodes.size(); x++) {
+			relation[x].clear();
+		}
+		map<pair<int, int>, vector<int> > lookback;
+		for (size_t x = 0; x < nodes.size(); x++) {
+			for (size_t pro = 0; pro < productions.size(); pro++) {
+				if (!(productions[pro].left == nodes[x].second)) {
 					continue;
 				}
-				// if the symbol after the point is the same as the symbol after the point of the current item
-				// derive the closure of the corresponding item and union it to the new status
-				else if (productions[shiftIter->pro].right[shiftIter->pointPos] == nextSymbol) {
-					status tempI = derive(Item{ shiftIter->pro,shiftIter->pointPos + 1 });
-					newI.insert(tempI.begin(), tempI.end());
+				const vector<Symbol>& right = productions[pro].right;
+				int p = nodes[x].first;
+				for (size_t i = 0; i < right.size() && p != -1; i++) {
+					if (!right[i].isVt) {
+						size_t j = i + 1;
+						while (j < right.size() && isNullable(right[j])) {
+							j++;
+						}
+						if (j == right.size()) {
+							relation[transitions[GOTO(p, right[i])]].push_back((int)x);
+						}
+					}
+					p = walk(p, right[i]);
+				}
+				if (p != -1) {
+					lookback[make_pair(p, (int)pro)].push_back((int)x);
 				}
 			}
+		}
+		digraph(relation, sets);
 
-			// if this new status is already in the DFA, then just add a new transfer
-			bool searchFlag = false;
-			int index = 0;
-			for (list<status>::iterator iterHave = dfa.stas.begin(); iterHave != dfa.stas.end(); iterHave++, index++) {
-				if (*iterHave == newI) {
-					// add a new transfer, from nowI to index(newI), with symbol nextSymbol
-					dfa.goTo[GOTO(nowI, nextSymbol)] = index;
-					// if there is already a behavior in LR1 table, then there is conflict
-					if (LR1_Table.count(GOTO(nowI, nextSymbol)) == 1) {
-						outputError("confict transition ");
-					}
-					// shift behavior
-					LR1_Table[GOTO(nowI, nextSymbol)] = Behavior{ shift,index };
-					searchFlag = true;
-					break;
+		for (size_t q = 0; q < reductions.size(); q++) {
+			for (size_t r = 0; r < reductions[q].size(); r++) {
+				const vector<int>& back = lookback[make_pair((int)q, reductions[q][r].first)];
+				for (size_t b = 0; b < back.size(); b++) {
+					reductions[q][r].second.unite(sets[back[b]]);
 				}
 			}
+		}
+	}
 
-			// this new status is not in the DFA
-			if (!searchFlag) {
-				// create a new status in the DFA, and add a new transfer
-				dfa.stas.push_back(newI);
-				dfa.goTo[GOTO(nowI, nextSymbol)] = (int)dfa.stas.size() - 1;
-				if (LR1_Table.count(GOTO(nowI, nextSymbol)) == 1) {
-					outputError("confict transition");
+	getPrecedences();
+	for (size_t q = 0; q < reductions.size(); q++) {
+		addReductions((int)q, reductions[q]);
+	}
+}
+
+/**
+ * @brief compute the precedence of each production, the one of its last terminal which has one
+ */
+void AnalyseTable::getPrecedences() {
+	productionPrecedence.assign(productions.size(), 0);
+	for (size_t pro = 0; pro < productions.size(); pro++) {
+		const vector<Symbol>& right = productions[pro].right;
+		for (size_t i = right.size(); i > 0; i--) {
+			map<Symbol, Precedence>::iterator found = precedence.find(right[i - 1]);
+			if (found != precedence.end()) {
+				productionPrecedence[pro] = found->second.level;
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * @brief add the reductions of a status to the LR1 table, which holds its shifts
+ * @details the conflicts are resolved or reported as getLookaheads describes
+ * @param state
+ * @param reductions: the productions reduced in the status, each with its lookaheads
+ */
+void AnalyseTable::addReductions(int state, const vector<pair<int, TerminalSet> >& reductions) {
+	for (size_t r = 0; r < reductions.size(); r++) {
+		int pro = reductions[r].first;
+		const TerminalSet& lookaheads = reductions[r].second;
+		for (int t = 0; t < terminalCount; t++) {
+			if (!lookaheads.contains(t)) {
+				continue;
+			}
+			map<GOTO, Behavior>::iterator existing = LR1_Table.find(GOTO(state, symbols[t]));
+			// a shift on a terminal with a precedence against a production with one
+			if (existing != LR1_Table.end() && existing->second.behavior == shift
+				&& precedence.count(symbols[t]) == 1 && productionPrecedence[pro] > 0) {
+				const Precedence& token = precedence[symbols[t]];
+				if (productionPrecedence[pro] > token.level
+					|| (productionPrecedence[pro] == token.level && token.associativity == Associativity::Left)) {
+					existing->second = Behavior{ (pro == 0) ? accept : reduct,pro };
 				}
-				LR1_Table[GOTO(nowI, nextSymbol)] = Behavior{ shift,int(dfa.stas.size() - 1) };
+				continue;
+			}
+			// exist conflict in LR1 table
+			if (existing != LR1_Table.end()) {
+				outputError("is not " + string(lookahead == LookaheadMode::SLR ? "SLR(1)" : "LALR(1)")
+					+ " grammar, exist conflict in GOTO( " + to_string(state) + ", " + symbols[t].content + " ) on production " + to_string(pro));
+				continue;
 			}
+			// if it is the reduction of the start symbol, then it is accept
+			// otherwise it is reduct
+			LR1_Table[GOTO(state, symbols[t])] = Behavior{ (pro == 0) ? accept : reduct,pro };
 		}
 	}
 }
 
 /**
- * @brief construct analyse table from product.txt
- * @param fileName 
+ * @brief number the symbols of the grammar
+ * @details a terminal is numbered by its TokenType, so the parser can index the tables by the type of a token.
+ * 		The non-terminals follow in the order they appear in the productions.
  */
-AnalyseTable::AnalyseTable(const char*fileName) {
-	readProductions(fileName);
-	getFirst();
-	getFollow();
-	createDFA();
+void AnalyseTable::numberSymbols() {
+	terminalCount = 0;
+	for (size_t i = 0; i < TERMINAL_COUNT; i++) {
+		terminalCount = max(terminalCount, (int)terminalKeys[i].type + 1);
+	}
+	symbols.assign(terminalCount, Symbol(true, ""));
+	for (size_t i = 0; i < TERMINAL_COUNT; i++) {
+		symbols[terminalKeys[i].type] = Symbol(true, string(terminalKeys[i].text, terminalKeys[i].length));
+	}
+	set<string> nonTerminals;
+	for (size_t i = 0; i < productions.size(); i++) {
+		if (nonTerminals.insert(productions[i].left.content).second) {
+			symbols.push_back(productions[i].left);
+		}
+	}
+	for (size_t i = 0; i < symbols.size(); i++) {
+		symbols[i].id = (int)i;
+	}
+	setProductionIds();
+}
+
+/**
+ * @brief give every symbol of the productions its id
+ */
+void AnalyseTable::setProductionIds() {
+	map<Symbol, int> ids;
+	for (size_t i = 0; i < symbols.size(); i++) {
+		ids[symbols[i]] = (int)i;
+	}
+	for (size_t i = 0; i < productions.size(); i++) {
+		productions[i].left.id = ids[productions[i].left];
+		for (size_t j = 0; j < productions[i].right.size(); j++) {
+			productions[i].right[j].id = ids.count(productions[i].right[j]) ? ids[productions[i].right[j]] : -1;
+		}
+	}
+}
+
+/**
+ * @brief the entry of the dense tables for a behavior of the LR1 table
+ */
+static TableEntry behaviorEntry(const Behavior& behavior) {
+	return (TableEntry)(behavior.behavior == shift ? behavior.nextStat + 1 : -(behavior.nextStat + 1));
+}
+
+/**
+ * @brief pack the DFA and the LR1 table into the dense tables, then free them
+ */
+void AnalyseTable::packTables() {
+	map<Symbol, int> ids;
+	for (size_t i = 0; i < symbols.size(); i++) {
+		ids[symbols[i]] = (int)i;
+	}
+	int nonTerminalCount = (int)symbols.size() - terminalCount;
+	stateCount = (int)dfa.stas.size();
+	actionStore.assign((size_t)stateCount * terminalCount, 0);
+	gotoStore.assign((size_t)stateCount * nonTerminalCount, 0);
+	for (map<GOTO, Behavior>::iterator iter = LR1_Table.begin(); iter != LR1_Table.end(); iter++) {
+		int state = iter->first.first;
+		int id = ids.count(iter->first.second) ? ids[iter->first.second] : -1;
+		TableEntry entry = behaviorEntry(iter->second);
+		if (id < 0) {
+			outputError("symbol " + iter->first.second.content + " is not in the grammar");
+		}
+		else if (id < terminalCount) {
+			actionStore[(size_t)state * terminalCount + id] = entry;
+		}
+		else {
+			gotoStore[(size_t)state * nonTerminalCount + id - terminalCount] = entry;
+		}
+	}
+	itemStartStore.assign(1, 0);
+	itemStore.clear();
+	for (list<status>::iterator iter = dfa.stas.begin(); iter != dfa.stas.end(); iter++) {
+		for (set<Item>::iterator itIter = iter->begin(); itIter != iter->end(); itIter++) {
+			itemStore.push_back((int16_t)itIter->pro);
+			itemStore.push_back((int16_t)itIter->pointPos);
+		}
+		itemStartStore.push_back((int32_t)itemStore.size() / 2);
+	}
+	itemCount = itemStartStore.back();
+	actions = actionStore.data();
+	gotos = gotoStore.data();
+	itemStart = itemStartStore.data();
+	items = itemStore.data();
+
+	dfa.stas.clear();
+	dfa.goTo.clear();
+	LR1_Table.clear();
+	first.clear();
+	follow.clear();
+	nullable.clear();
+	precedence.clear();
+}
+
+/**
+ * @brief find the state of a kernel in a lazy table, or add it with empty rows
+ * @param kernel
+ * @return int: the state
+ */
+int AnalyseTable::findState(const vector<Item>& kernel) {
+	unordered_map<vector<Item>, int, KernelHash>::iterator found = kernelIds.find(kernel);
+	if (found != kernelIds.end()) {
+		return found->second;
+	}
+	kernelIds[kernel] = stateCount;
+	kernels.push_back(kernel);
+	built.push_back(false);
+	actionStore.resize(actionStore.size() + terminalCount, 0);
+	gotoStore.resize(gotoStore.size() + symbols.size() - terminalCount, 0);
+	actions = actionStore.data();
+	gotos = gotoStore.data();
+	return stateCount++;
+}
+
+/**
+ * @brief build a state of a lazy table: close its kernel and fill its rows
+ * @details the targets of its gotos are found or added as createDFA does for a status, without being built.
+ * 		A production reduces on the FOLLOW set of its left symbol, and a conflict is reported when the state
+ * 		is built, so a grammar which is not SLR(1) is only reported for the states a parse reaches.
+ * @param state
+ */
+void AnalyseTable::buildState(int state) {
+	status closure = derive(kernels[state]);
+	// the kernel of the goto on each symbol after a point, in the order the symbols appear
+	vector<Symbol> order;
+	map<Symbol, vector<Item> > gotoKernels;
+	vector<pair<int, TerminalSet> > reductions;
+	for (set<Item>::iterator itIter = closure.begin(); itIter != closure.end(); itIter++) {
+		const Production& production = productions[itIter->pro];
+		if ((int)production.right.size() == itIter->pointPos) {
+			reductions.push_back(make_pair(itIter->pro, follow[production.left.id - terminalCount]));
+			continue;
+		}
+		vector<Item>& kernel = gotoKernels[production.right[itIter->pointPos]];
+		if (kernel.empty()) {
+			order.push_back(production.right[itIter->pointPos]);
+		}
+		kernel.push_back(Item{ itIter->pro,itIter->pointPos + 1 });
+	}
+	for (size_t i = 0; i < order.size(); i++) {
+		LR1_Table[GOTO(state, order[i])] = Behavior{ shift,findState(gotoKernels[order[i]]) };
+	}
+	addReductions(state, reductions);
+
+	int nonTerminalCount = (int)symbols.size() - terminalCount;
+	for (map<GOTO, Behavior>::iterator iter = LR1_Table.begin(); iter != LR1_Table.end(); iter++) {
+		int id = iter->first.second.id;
+		if (id < 0) {
+			outputError("symbol " + iter->first.second.content + " is not in the grammar");
+		}
+		else if (id < terminalCount) {
+			actionStore[(size_t)state * terminalCount + id] = behaviorEntry(iter->second);
+		}
+		else {
+			gotoStore[(size_t)state * nonTerminalCount + id - terminalCount] = behaviorEntry(iter->second);
+		}
+	}
+	LR1_Table.clear();
+	built[state] = true;
+	builtCount++;
+}
+
+/**
+ * @brief pack the items of the states a lazy table found so far, for outputDFA
+ * @details a state which is not built yet shows its closure all the same
+ */
+void AnalyseTable::packItems() {
+	itemStartStore.assign(1, 0);
+	itemStore.clear();
+	for (int s = 0; s < stateCount; s++) {
+		status closure = derive(kernels[s]);
+		for (set<Item>::iterator itIter = closure.begin(); itIter != closure.end(); itIter++) {
+			itemStore.push_back((int16_t)itIter->pro);
+			itemStore.push_back((int16_t)itIter->pointPos);
+		}
+		itemStartStore.push_back((int32_t)itemStore.size() / 2);
+	}
+	itemCount = itemStartStore.back();
+	itemStart = itemStartStore.data();
+	items = itemStore.data();
+}
+
+/**
+ * @brief FNV-1a hash of the grammar file and the terminal table
+ * @details the terminals are numbered by their TokenType, so the tables of a grammar are only valid with the
+ * 		terminal table they were built with. The spelling, type and kind of every terminal are hashed after the file.
+ * @param fileName
+ * @return uint64_t: 0 if the file can not be read
+ */
+uint64_t AnalyseTable::grammarHash(const char* fileName) {
+	SourceBuffer grammar;
+	if (!grammar.open(fileName, SourceMode::Map)) {
+		return 0;
+	}
+	uint64_t h = 14695981039346656037ull;
+	for (const char* p = grammar.begin(); p != grammar.end(); p++) {
+		h = (h ^ (unsigned char)*p) * 1099511628211ull;
+	}
+	for (size_t i = 0; i < TERMINAL_COUNT; i++) {
+		const TerminalEntry& terminal = terminalKeys[i];
+		// the spelling ends with a 0 so the next type is not taken as a char of it
+		for (size_t j = 0; j <= terminal.length; j++) {
+			h = (h ^ (unsigned char)(j < terminal.length ? terminal.text[j] : 0)) * 1099511628211ull;
+		}
+		h = (h ^ (unsigned)terminal.type) * 1099511628211ull;
+		h = (h ^ (unsigned)terminal.lexeme) * 1099511628211ull;
+	}
+	return h;
+}
+
+/**
+ * @brief reads the numbers and strings of the cache, every read is checked against the end of the file
+ */
+struct CacheReader {
+	const char* begin;
+	const char* p;
+	const char* end;
+	bool ok;
+	uint32_t u32() {
+		uint32_t value = 0;
+		if (end - p < 4) {
+			ok = false;
+			return 0;
+		}
+		memcpy(&value, p, 4);
+		p += 4;
+		return value;
+	}
+	uint64_t u64() {
+		uint64_t low = u32();
+		return low | (uint64_t)u32() << 32;
+	}
+	string str() {
+		uint32_t length = u32();
+		if (!ok || (size_t)(end - p) < length) {
+			ok = false;
+			return "";
+		}
+		p += length;
+		return string(p - length, length);
+	}
+	// an array in place, it starts at a multiple of 4 bytes from the begin of the file
+	template<class T> const T* array(size_t count) {
+		p += (4 - (p - begin) % 4) % 4;
+		if (!ok || p > end || (size_t)(end - p) / sizeof(T) < count || (uintptr_t)p % alignof(T) != 0) {
+			ok = false;
+			return nullptr;
+		}
+		const T* result = (const T*)p;
+		p += count * sizeof(T);
+		return result;
+	}
+};
+
+// append a number, a string or an array to the cache
+static void put32(string& out, uint32_t value) {
+	out.append((const char*)&value, 4);
+}
+
+static void putString(string& out, const string& text) {
+	put32(out, (uint32_t)text.size());
+	out += text;
+}
+
+template<class T> static void putArray(string& out, const T* data, size_t count) {
+	out.append((4 - out.size() % 4) % 4, '\0');
+	out.append((const char*)data, count * sizeof(T));
+}
+
+/**
+ * @brief load the tables from the cache
+ * @details the file starts with "LRTC", the version and the hash of the grammar and the terminal table, then the counts, the symbols
+ * 		and the productions. The dense tables follow as arrays in the byte order of this machine; the file stays
+ * 		mapped and the parser reads them in place.
+ * @param cacheName
+ * @param hash: see grammarHash, the cache must have been made from the same grammar and terminals
+ * @return true if the cache is valid and loaded
+ */
+bool AnalyseTable::loadCache(const char* cacheName, uint64_t hash) {
+	if (hash == 0 || !cache.open(cacheName, SourceMode::Map)) {
+		return false;
+	}
+	CacheReader in{ cache.begin(), cache.begin(), cache.end(), true };
+	if (in.str() != "LRTC" || in.u32() != TABLE_CACHE_VERSION || in.u64() != hash || !in.ok) {
+		cache.close();
+		return false;
+	}
+
+	uint32_t symbolCount = in.u32();
+	terminalCount = (int)in.u32();
+	uint32_t productionCount = in.u32();
+	stateCount = (int)in.u32();
+	itemCount = (int)in.u32();
+	if (symbolCount > 0x7FFF || (uint32_t)terminalCount > symbolCount || productionCount > 0x7FFF
+		|| stateCount < 0 || stateCount > 0x7FFF || itemCount < 0) {
+		in.ok = false;
+	}
+	for (uint32_t i = 0; i < symbolCount && in.ok; i++) {
+		bool isVt = in.u32() != 0;
+		symbols.push_back(Symbol(isVt, in.str()));
+		symbols.back().id = (int)i;
+	}
+	// read an id of a symbol
+	auto symbol = [&]() -> Symbol {
+		uint32_t id = in.u32();
+		if (id >= symbols.size()) {
+			in.ok = false;
+			return Symbol();
+		}
+		return symbols[id];
+	};
+	for (uint32_t i = 0; i < productionCount && in.ok; i++) {
+		Production p;
+		p.id = (int)i;
+		p.left = symbol();
+		// each symbol of the right side takes 4 bytes, a longer side is broken
+		uint32_t length = in.u32();
+		if (!in.ok || length > 0x7FFF || length > (size_t)(in.end - in.p) / 4) {
+			in.ok = false;
+			break;
+		}
+		p.right.resize(length);
+		for (size_t j = 0; j < p.right.size() && in.ok; j++) {
+			p.right[j] = symbol();
+		}
+		productions.push_back(p);
+	}
+	int nonTerminalCount = (int)symbolCount - terminalCount;
+	itemStart = in.array<int32_t>((size_t)stateCount + 1);
+	items = in.array<int16_t>((size_t)itemCount * 2);
+	actions = in.array<TableEntry>((size_t)stateCount * terminalCount);
+	gotos = in.array<TableEntry>((size_t)stateCount * nonTerminalCount);
+
+	// the targets and the items must be in range, the parser and outputDFA do not check them
+	if (in.ok && in.p == in.end) {
+		in.ok = itemStart[0] == 0 && itemStart[stateCount] == itemCount;
+		for (int i = 0; i < stateCount && in.ok; i++) {
+			in.ok = itemStart[i] <= itemStart[i + 1];
+		}
+		for (int i = 0; i < itemCount && in.ok; i++) {
+			int pro = items[2 * i], point = items[2 * i + 1];
+			in.ok = pro >= 0 && pro < (int)productionCount && point >= 0 && point <= (int)productions[pro].right.size();
+		}
+		for (int i = 0; i < stateCount * terminalCount && in.ok; i++) {
+			in.ok = actions[i] <= 0 ? entryTarget(actions[i]) < (int)productionCount || actions[i] == 0 : entryTarget(actions[i]) < stateCount;
+		}
+		for (int i = 0; i < stateCount * nonTerminalCount && in.ok; i++) {
+			in.ok = gotos[i] >= 0 && entryTarget(gotos[i]) < stateCount;
+		}
+	}
+	// a broken cache is ignored
+	if (!in.ok || in.p != in.end) {
+		symbols.clear();
+		productions.clear();
+		cache.close();
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief write the tables into the cache, see loadCache for the format
+ * @details the cache is written into a temporary file first, so a cache is either complete or missing
+ * @param cacheName
+ * @param hash: hash of the grammar file
+ */
+void AnalyseTable::saveCache(const char* cacheName, uint64_t hash) {
+	if (hash == 0) {
+		return;
+	}
+	string out;
+	putString(out, "LRTC");
+	put32(out, TABLE_CACHE_VERSION);
+	put32(out, (uint32_t)hash);
+	put32(out, (uint32_t)(hash >> 32));
+	put32(out, (uint32_t)symbols.size());
+	put32(out, (uint32_t)terminalCount);
+	put32(out, (uint32_t)productions.size());
+	put32(out, (uint32_t)stateCount);
+	put32(out, (uint32_t)itemCount);
+	for (size_t i = 0; i < symbols.size(); i++) {
+		put32(out, symbols[i].isVt ? 1 : 0);
+		putString(out, symbols[i].content);
+	}
+	for (size_t i = 0; i < productions.size(); i++) {
+		put32(out, (uint32_t)productions[i].left.id);
+		put32(out, (uint32_t)productions[i].right.size());
+		for (size_t j = 0; j < productions[i].right.size(); j++) {
+			put32(out, (uint32_t)productions[i].right[j].id);
+		}
+	}
+	putArray(out, itemStart, (size_t)stateCount + 1);
+	putArray(out, items, (size_t)itemCount * 2);
+	putArray(out, actions, (size_t)stateCount * terminalCount);
+	putArray(out, gotos, (size_t)stateCount * (symbols.size() - terminalCount));
+
+	string tempName = string(cacheName) + ".tmp";
+	ofstream fout(tempName.c_str(), ios::out | ios::binary);
+	if (!fout.is_open()) {
+		return;
+	}
+	fout.write(out.data(), out.size());
+	fout.close();
+	if (!fout) {
+		remove(tempName.c_str());
+		return;
+	}
+	remove(cacheName);
+	rename(tempName.c_str(), cacheName);
+}
+
+/**
+ * @brief take the tables from the arrays of ParserTables.h
+ * @details only the symbols and productions are made, the parser reads the dense tables in place
+ */
+void AnalyseTable::loadGenerated() {
+	terminalCount = PARSE_TERMINAL_COUNT;
+	stateCount = PARSE_STATE_COUNT;
+	itemCount = parseStateItemStart[PARSE_STATE_COUNT];
+	for (int i = 0; i < PARSE_SYMBOL_COUNT; i++) {
+		symbols.push_back(Symbol(i < PARSE_TERMINAL_COUNT, parseSymbolName[i]));
+		symbols.back().id = i;
+	}
+	for (int i = 0; i < PARSE_PRODUCTION_COUNT; i++) {
+		Production p;
+		p.id = i;
+		p.left = symbols[parseProductionLeft[i]];
+		for (int j = parseProductionRightStart[i]; j < parseProductionRightStart[i + 1]; j++) {
+			p.right.push_back(symbols[parseProductionRight[j]]);
+		}
+		productions.push_back(p);
+	}
+	actions = &parseAction[0][0];
+	gotos = &parseGoto[0][0];
+	itemStart = parseStateItemStart;
+	items = &parseItems[0][0];
 }
 
 /**
@@ -342,20 +1152,23 @@ AnalyseTable::AnalyseTable(const char*fileName) {
  * @param out: the output stream
  */
 void AnalyseTable::outputDFA(ostream& out) {
-	int nowI = 0;
-	for (list<status>::iterator iter = dfa.stas.begin(); iter != dfa.stas.end(); iter++, nowI++) {
+	if (!kernels.empty()) {
+		packItems();
+	}
+	for (int nowI = 0; nowI < stateCount; nowI++) {
 		out << "I" << nowI << "= [";
-		for (set<Item>::iterator itIter = iter->begin(); itIter != iter->end(); itIter++) {
+		for (int i = itemStart[nowI]; i < itemStart[nowI + 1]; i++) {
 			out << "[";
-			Production p = productions[itIter->pro];
+			const Production& p = productions[items[2 * i]];
+			int pointPos = items[2 * i + 1];
 			out << p.left.content << " -> ";
-			for (vector<Symbol>::iterator symIter = p.right.begin(); symIter != p.right.end(); symIter++) {
-				if (symIter - p.right.begin() == itIter->pointPos) {
+			for (size_t j = 0; j < p.right.size(); j++) {
+				if ((int)j == pointPos) {
 					out << ". ";
 				}
-				out << symIter->content << " ";
+				out << p.right[j].content << " ";
 			}
-			if (p.right.size() == itIter->pointPos) {
+			if ((int)p.right.size() == pointPos) {
 				out << ". ";
 			}
 			out << "]";
@@ -375,4 +1188,137 @@ void AnalyseTable::outputDFA(const char* fileName) {
 	}
 	outputDFA(fout);
 	fout.close();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief write a constexpr array of numbers, 16 in a line
+ */
+template<class T> static void outputArray(ostream& out, const char* declaration, const T* data, size_t count) {
+	out << "static constexpr " << declaration << " = {";
+	for (size_t i = 0; i < count; i++) {
+		out << (i % 16 == 0 ? "\n\t" : " ") << (int)data[i] << (i + 1 == count ? "" : ",");
+	}
+	out << (count == 0 ? "0" : "") << endl << "};" << endl;
+}
+
+/**
+ * @brief write the tables into a header of constexpr arrays
+ * @details the symbols keep their ids and the tables their layout, see TableEntry for the entries
+ * @param fileName: the header to write
+ * @param grammarName: the grammar file, its hash is written into the header
+ * @return true if the header is written
+ */
+bool AnalyseTable::outputTables(const char* fileName, const char* grammarName) {
+	if (!kernels.empty()) {
+		cerr << "the states of a lazy table are not all built" << endl;
+		return false;
+	}
+	if (stateCount >= 32767 || (int)productions.size() >= 32767) {
+		cerr << "too many states or productions for 16-bit tables" << endl;
+		return false;
+	}
+	ofstream fout;
+	fout.open(fileName, ios::out);
+	if (!fout.is_open()) {
+		cerr << "fail to open file " << fileName << endl;
+		return false;
+	}
+	int nonTerminalCount = (int)symbols.size() - terminalCount;
+	fout << "// generated by parsegen from " << grammarName << ", do not edit" << endl;
+	fout << "// " << productions.size() << " productions, " << stateCount << " states, " << symbols.size() << " symbols" << endl;
+	fout << "#ifndef PARSERTABLES_H" << endl;
+	fout << "#define PARSERTABLES_H" << endl;
+	fout << "#include <cstdint>" << endl << endl;
+	fout << "// FNV-1a hash of the grammar file and the terminal table, the tables are used only for them" << endl;
+	fout << "#define PARSE_GRAMMAR_HASH 0x" << hex << grammarHash(grammarName) << dec << "ull" << endl;
+	fout << "#define PARSE_SYMBOL_COUNT " << symbols.size() << endl;
+	fout << "#define PARSE_TERMINAL_COUNT " << terminalCount << endl;
+	fout << "#define PARSE_PRODUCTION_COUNT " << productions.size() << endl;
+	fout << "#define PARSE_STATE_COUNT " << stateCount << endl << endl;
+
+	fout << "// the spelling of each symbol, a terminal is numbered by its TokenType and the non-terminals follow" << endl;
+	fout << "static constexpr const char* parseSymbolName[PARSE_SYMBOL_COUNT] = {";
+	for (size_t i = 0; i < symbols.size(); i++) {
+		fout << (i % 8 == 0 ? "\n\t" : " ") << "\"" << symbols[i].content << "\"" << (i + 1 == symbols.size() ? "" : ",");
+	}
+	fout << endl << "};" << endl << endl;
+
+	vector<int16_t> left, length, right, rightStart(1, 0);
+	for (size_t i = 0; i < productions.size(); i++) {
+		left.push_back((int16_t)productions[i].left.id);
+		length.push_back((int16_t)productions[i].right.size());
+		for (size_t j = 0; j < productions[i].right.size(); j++) {
+			right.push_back((int16_t)productions[i].right[j].id);
+		}
+		rightStart.push_back((int16_t)right.size());
+	}
+	fout << "// the left symbol and the number of right symbols of each production" << endl;
+	outputArray(fout, "int16_t parseProductionLeft[PARSE_PRODUCTION_COUNT]", left.data(), left.size());
+	outputArray(fout, "int16_t parseProductionLength[PARSE_PRODUCTION_COUNT]", length.data(), length.size());
+	fout << endl << "// the right symbols of production p are parseProductionRight[parseProductionRightStart[p] ..]" << endl;
+	outputArray(fout, "int16_t parseProductionRightStart[PARSE_PRODUCTION_COUNT + 1]", rightStart.data(), rightStart.size());
+	outputArray(fout, ("int16_t parseProductionRight[" + to_string(max<size_t>(right.size(), 1)) + "]").c_str(), right.data(), right.size());
+
+	fout << endl << "// the items of state s are parseItems[parseStateItemStart[s] ..], each is { production, position of the point }" << endl;
+	outputArray(fout, "int32_t parseStateItemStart[PARSE_STATE_COUNT + 1]", itemStart, (size_t)stateCount + 1);
+	fout << "static constexpr int16_t parseItems[" << max(itemCount, 1) << "][2] = {";
+	for (int i = 0; i < itemCount; i++) {
+		fout << (i % 8 == 0 ? "\n\t" : " ") << "{ " << items[2 * i] << ", " << items[2 * i + 1] << " }" << (i + 1 == itemCount ? "" : ",");
+	}
+	fout << (itemCount == 0 ? "{ 0, 0 }" : "") << endl << "};" << endl << endl;
+
+	fout << "// parseAction[state][terminal]: 0 error, s + 1 shift to state s, -(p + 1) reduce by production p, -1 accept" << endl;
+	fout << "static constexpr int16_t parseAction[PARSE_STATE_COUNT][PARSE_TERMINAL_COUNT] = {" << endl;
+	for (int s = 0; s < stateCount; s++) {
+		fout << "\t{";
+		for (int t = 0; t < terminalCount; t++) {
+			fout << (t ? ", " : " ") << actions[s * terminalCount + t];
+		}
+		fout << " }" << (s + 1 == stateCount ? "" : ",") << endl;
+	}
+	fout << "};" << endl << endl;
+
+	fout << "// parseGoto[state][non-terminal - PARSE_TERMINAL_COUNT]: 0 error, s + 1 go to state s" << endl;
+	fout << "static constexpr int16_t parseGoto[PARSE_STATE_COUNT][PARSE_SYMBOL_COUNT - PARSE_TERMINAL_COUNT] = {" << endl;
+	for (int s = 0; s < stateCount; s++) {
+		fout << "\t{";
+		for (int n = 0; n < nonTerminalCount; n++) {
+			fout << (n ? ", " : " ") << gotos[s * nonTerminalCount + n];
+		}
+		fout << " }" << (s + 1 == stateCount ? "" : ",") << endl;
+	}
+	fout << "};" << endl << endl;
+	fout << "#endif // !PARSERTABLES_H" << endl;
+	fout.close();
+	return true;
+}
+
+/**
+ * @brief choose the tables action and goTo read
+ * @details the comb vectors are built from the dense tables the first time they are chosen.
+ * 		An action may default to a reduction, a goto to any state, since the parser never asks for the goto
+ * 		of a state on a non-terminal it has no goto on.
+ * @param backend
+ */
+void AnalyseTable::setBackend(TableBackend backend) {
+	if (backend == TableBackend::Comb && !kernels.empty()) {
+		outputError("the rows of a lazy table grow while it is used, they can not be compressed");
+		return;
+	}
+	if (backend == TableBackend::Comb && combActions.slotCount() == 0 && stateCount > 0) {
+		combActions.build(actions, stateCount, terminalCount, isReduceEntry);
+		combGotos.build(gotos, stateCount, (int)symbols.size() - terminalCount, isShiftEntry);
+	}
+	this->backend = backend;
+}
+
+/**
+ * @brief get the size of the action and goto tables the lookups read
+ * @return size_t: bytes
+ */
+size_t AnalyseTable::tableSize() const {
+	if (backend == TableBackend::Comb) {
+		return combActions.memoryUsage() + combGotos.memoryUsage();
+	}
+	return (size_t)stateCount * symbols.size() * sizeof(TableEntry);
+}
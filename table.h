@@ -1,6 +1,8 @@
 #ifndef TABLE_H
 #define TABLE_H
 #include "Symbol.h"
+#include "SourceBuffer.h"
+#include "CombTable.h"
 
 /**
  * @file table.h
@@ -16,9 +18,30 @@ struct Item {
 	friend bool operator <(const Item&one, const Item& other);
 };
 
+//a set of terminals, a bit for each terminal id
+class TerminalSet {
+private:
+	vector<uint64_t> words;
+public:
+	explicit TerminalSet(int count = 0) : words((count + 63) / 64, 0) {}
+	void insert(int terminal) { words[terminal >> 6] |= (uint64_t)1 << (terminal & 63); }
+	bool contains(int terminal) const { return (words[terminal >> 6] >> (terminal & 63) & 1) != 0; }
+	// add the terminals of another set of the same size
+	void unite(const TerminalSet& other) {
+		for (size_t i = 0; i < words.size(); i++) {
+			words[i] |= other.words[i];
+		}
+	}
+};
+
 //a status in DFA, a status is a set of lr(1) items
 typedef set<Item> status;
 
+//hash of the kernel of a status, which identifies it
+struct KernelHash {
+	size_t operator()(const vector<Item>& kernel) const;
+};
+
 //a transfer in DFA
 typedef pair<int, Symbol> GOTO;
 
@@ -30,33 +53,200 @@ struct DFA {
 	map<GOTO, int> goTo;
 };
 
+//the associativity of a terminal, declared with %left or %right
+enum class Associativity {
+	Left,
+	Right
+};
+
+//the precedence of a terminal, a higher level binds tighter
+struct Precedence {
+	int level;
+	Associativity associativity;
+};
+
 //the behavior of a status in LR1 table
 struct Behavior {
 	tableBehave behavior;
 	int nextStat;
 };
 
+// a frontier of the DFA smaller than this is built by the calling thread
+#define PARALLEL_DFA_MIN_FRONTIER 64
+
+// the tables are cached in the grammar file name followed by this
+#define TABLE_CACHE_SUFFIX ".cache"
+// change it when the cache format or the way the tables are built changes
+#define TABLE_CACHE_VERSION 3
+
+/*
+ * an entry of the tables: 0 is an error, s + 1 shifts or goes to state s, -(p + 1) reduces by production p,
+ * and -1, the reduction of the start production, accepts
+ */
+inline bool isShiftEntry(TableEntry entry) { return entry > 0; }
+inline bool isReduceEntry(TableEntry entry) { return entry < -1; }
+inline bool isAcceptEntry(TableEntry entry) { return entry == -1; }
+// the state of a shift or goto, the production of a reduction
+inline int entryTarget(TableEntry entry) { return entry > 0 ? entry - 1 : -entry - 1; }
+
+// how the lookaheads of the reductions are computed
+enum class LookaheadMode {
+	SLR,		// the FOLLOW set of the left symbol
+	LALR		// the LALR(1) lookaheads of DeRemer and Pennello
+};
+
+// when the states of the DFA are built
+enum class StateConstruction {
+	Eager,		// all of them, before the first parse
+	Lazy		// each one the first time the parser reaches it, see AnalyseTable::reach, the lookaheads are SLR(1)
+};
+
+// the seconds each step of building the tables from the grammar took, all 0 for loaded tables
+struct TableBuildTimes {
+	double read;			// read and number the productions
+	double firstFollow;		// FIRST, FOLLOW and the non-terminals deriving EMPTY
+	double automaton;		// the LR(0) DFA, only the start state for a lazy table
+	double lookaheads;		// the reductions and the conflicts
+	double pack;			// the dense tables
+};
+
+// how the parser looks the tables up
+enum class TableBackend {
+	Dense,		// one array load per lookup
+	Comb		// row displacement with a default reduction per state, see CombTable
+};
+
 
 /**
  * @brief analyse table class, including DFA, LR1 table, first set and follow set, construct from product.txt
  * @author chtholly
+ * @details the grammar symbols are numbered: a terminal is numbered by its TokenType, the non-terminals follow.
+ * 		The parser reads the dense tables, actions[state][terminal] and gotos[state][non-terminal], with one array load.
+ * 		They are in ParserTables.h for the grammar parsegen was run on, in the mapped cache for a grammar seen before,
+ * 		or packed from the LR1 table just built. The DFA and the LR1 table maps only exist while the tables are built.
+ * 		With TableBackend::Comb the lookups read comb vectors built from the dense tables instead, which are smaller
+ * 		for large grammars. A state whose actions reduce by a single production then reduces on any terminal it
+ * 		has no shift for, so a syntax error is found after the reductions, still before the wrong token is shifted.
+ * 		With StateConstruction::Lazy only the start state is built with the table. The others are found as the
+ * 		targets of the gotos of a built state, get an empty row, and are built when the parser first reaches them.
+ * 		Their reductions use the FOLLOW sets, since the LALR(1) lookaheads of a state depend on the whole DFA,
+ * 		so a lazy table is SLR(1) whatever LookaheadMode it is constructed with.
  */
 class AnalyseTable {
 private:
-	vector<Production>productions;		// all productions of this grammar
+	vector<Production>productions;		// all productions of this grammar, the symbols have their ids
 	DFA dfa;							// construct DFA from product.txt
 	map<GOTO,Behavior> LR1_Table;		// construct LR1 table from product.txt
-	map<Symbol,set<Symbol> >first;		// construct first set from product.txt
-	map<Symbol, set<Symbol> >follow;	// construct follow set from product.txt
+	vector<TerminalSet> first;			// first set of each non-terminal, by id - terminalCount
+	vector<TerminalSet> follow;			// follow set of each non-terminal, by id - terminalCount
+	vector<bool> nullable;				// if each non-terminal derives EMPTY, by id - terminalCount
+	map<Symbol, Precedence> precedence;	// the terminals declared with %left or %right
+	bool rebuilt;						// the tables are built from the grammar, not loaded from the cache
+	bool generated;						// the tables are taken from ParserTables.h
+	LookaheadMode lookahead;			// how the reductions were computed
+	TableBuildTimes buildTimes;			// how long building the tables took
+	vector<int> productionPrecedence;	// the precedence level of each production, 0 if it has none
+
+	vector<Symbol> symbols;				// symbol of each id, terminals which are not in the grammar are empty
+	int terminalCount;					// ids below it are terminals
+	int stateCount;						// number of states of the DFA
+	int itemCount;						// number of items of all states
+	// the dense tables, they point into ParserTables.h, the mapped cache or the stores below
+	const TableEntry* actions;			// [state][terminal]
+	const TableEntry* gotos;			// [state][non-terminal - terminalCount]
+	const int32_t* itemStart;			// the items of state s are items[itemStart[s] .. itemStart[s + 1])
+	const int16_t* items;				// pairs of production and position of the point
+	vector<TableEntry> actionStore;
+	vector<TableEntry> gotoStore;
+	vector<int32_t> itemStartStore;
+	vector<int16_t> itemStore;
+	SourceBuffer cache;					// the mapped cache file
+	TableBackend backend;				// the tables action and goTo read
+	CombTable combActions;				// the compressed tables, only built for TableBackend::Comb
+	CombTable combGotos;
+	// the states of a lazy table, empty for an eager one
+	vector<vector<Item> > kernels;		// the kernel of each state found so far
+	unordered_map<vector<Item>, int, KernelHash> kernelIds;
+	vector<char> built;					// if the rows of each state are filled
+	int builtCount;						// number of states built
 
-	status derive(Item item);
+	vector<vector<int> > closures;		// productions derived from each non-terminal, while the DFA is created
+	static int buildThreads;			// threads of createDFA, 0 for one per core
+	void getClosures();
+	status derive(const vector<Item>& kernel) const;
 	void readProductions(const char*fileName);
 	void getFirst();
 	void getFollow();
+	bool isNullable(const Symbol& symbol) const;
 	void createDFA(); 
+	// add the reductions to the LR1 table
+	void getLookaheads();
+	void getPrecedences();
+	void addReductions(int state, const vector<pair<int, TerminalSet> >& reductions);
+	// the states of a lazy table
+	int findState(const vector<Item>& kernel);
+	void buildState(int state);
+	void packItems();
+	// number the symbols and pack the DFA and LR1 table into the dense tables
+	void numberSymbols();
+	void packTables();
+	// give the symbols of the productions their ids
+	void setProductionIds();
+	// the binary cache of the productions and the dense tables
+	static uint64_t grammarHash(const char* fileName);
+	bool loadCache(const char* cacheName, uint64_t hash);
+	void saveCache(const char* cacheName, uint64_t hash);
+	// the tables compiled into the program by parsegen
+	void loadGenerated();
 public:
 	friend class Parser;
-	AnalyseTable(const char*fileName);
+	AnalyseTable(const char*fileName, bool reuse = true, LookaheadMode lookahead = LookaheadMode::LALR,
+		StateConstruction construction = StateConstruction::Eager);
+	AnalyseTable(const AnalyseTable&) = delete;
+	AnalyseTable& operator=(const AnalyseTable&) = delete;
+	// choose the number of threads building the DFA of the tables constructed from now on, 0 for one per core
+	static void setBuildThreads(int count) { buildThreads = count; }
+	// if the tables were built from the grammar because the cache was missing or out of date
+	bool isRebuilt() { return rebuilt; }
+	// if the tables are the ones compiled into the program
+	bool isGenerated() { return generated; }
+	// choose the tables the lookups read, the compressed ones are built on the first switch to them
+	void setBackend(TableBackend backend);
+	TableBackend getBackend() const { return backend; }
+	// bytes of the action and goto tables of the current backend
+	size_t tableSize() const;
+	// build a state of a lazy table the first time the parser reaches it, before its actions are looked up
+	void reach(int state) {
+		if (state < (int)built.size() && !built[state]) {
+			buildState(state);
+		}
+	}
+	// getter, a lazy table counts the states found so far and the ones of them built
+	int getStateCount() const { return stateCount; }
+	int getBuiltStateCount() const { return kernels.empty() ? stateCount : builtCount; }
+	const TableBuildTimes& getBuildTimes() const { return buildTimes; }
+	int getTerminalCount() const { return terminalCount; }
+	int getSymbolCount() const { return (int)symbols.size(); }
+	const vector<Production>& getProductions() const { return productions; }
+	const vector<Symbol>& getSymbols() const { return symbols; }
+	// the action of a state on a terminal, the terminal id is its TokenType
+	TableEntry action(int state, int terminal) const {
+		if (terminal >= terminalCount) {
+			return 0;
+		}
+		return backend == TableBackend::Comb ? combActions.lookup(state, terminal) : actions[state * terminalCount + terminal];
+	}
+	// the goto of a state on a non-terminal
+	TableEntry goTo(int state, int symbol) const {
+		if (symbol < terminalCount) {
+			return 0;
+		}
+		symbol -= terminalCount;
+		return backend == TableBackend::Comb ? combGotos.lookup(state, symbol)
+			: gotos[state * ((int)symbols.size() - terminalCount) + symbol];
+	}
+	// write the tables as a header of constexpr arrays, for parsegen
+	bool outputTables(const char* fileName, const char* grammarName);
 	// output functions
 	void outputDFA(ostream& out);
 	void outputDFA(const char* fileName);
@@ -7,13 +7,6 @@ void outputError(string err) {
 	errorMessage = err;
 }
 
-list<int>merge(list<int>&l1, list<int>&l2) {
-	list<int>ret;
-	ret.assign(l1.begin(), l1.end());
-	ret.splice(ret.end(), l2);
-	return ret;
-}
-
 bool isVar(string name) {
 	return isalpha(name[0]);
 }
@@ -7,12 +7,15 @@
 #include <utility>
 #include <string>
 #include <list>
+#include <deque>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <stack>
 #include <queue>
 #include <cstdlib>
+#include <cstdint>
 #include <cassert>
 #include <functional>
 #include <algorithm>
@@ -30,6 +33,11 @@ using namespace std;
 extern string errorMessage;
 extern string infoMessage;
 
+/**
+ * @brief an interned string, the text is kept by the Interner of the compilation
+ */
+typedef uint32_t Atom;
+
 /**
  * @brief the type of table behavior
  */
@@ -63,13 +71,6 @@ enum DType {
  */
 void outputError(string err);
 
-/**
- * @brief Construct a new list<int>merge object
- * @param l1 
- * @param l2 
- */
-list<int>merge(list<int>&l1, list<int>&l2);
-
 /**
  * @brief if the string is end symbol
  * 